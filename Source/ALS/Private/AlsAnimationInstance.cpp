@@ -2,11 +2,13 @@
 
 #include "AlsAnimationInstanceProxy.h"
 #include "AlsCharacter.h"
+#include "AlsFootLockSubsystem.h"
 #include "DrawDebugHelpers.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Curves/CurveFloat.h"
 #include "Engine/SkeletalMesh.h"
+#include "SkeletalRenderPublic.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/WorldSettings.h"
 #include "Math/SpringMath.h"
@@ -18,11 +20,16 @@
 #include "Utility/AlsMontageUtility.h"
 #include "Utility/AlsPrivateMemberAccessor.h"
 #include "Utility/AlsRotation.h"
+#include "Utility/AlsStats.h"
 #include "Utility/AlsUtility.h"
 #include "Utility/AlsVector.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsAnimationInstance)
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Dormant Animation Instances"), STAT_Als_DormantAnimationInstances, STATGROUP_Als)
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Dormant Animation Instances Time Saved (ms)"), STAT_Als_DormantAnimationInstancesTimeSaved, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Reduced LOD Animation Instances"), STAT_Als_ReducedLodAnimationInstances, STATGROUP_Als)
+
 ALS_DEFINE_PRIVATE_MEMBER_ACCESSOR(AlsGetAnimationCurvesAccessor, &FAnimInstanceProxy::GetAnimationCurves,
                                    const TMap<FName, float>& (FAnimInstanceProxy::*)(EAnimCurveType) const)
 
@@ -44,14 +51,25 @@ void UAlsAnimationInstance::NativeInitializeAnimation()
 
 	const auto* Mesh{GetSkelMeshComponent()};
 
+	PelvisBoneIndex = INDEX_NONE;
+	FootLeftIkBoneIndex = INDEX_NONE;
+	FootRightIkBoneIndex = INDEX_NONE;
+	FootLeftVirtualBoneIndex = INDEX_NONE;
+	FootRightVirtualBoneIndex = INDEX_NONE;
+
 	if (IsValid(Mesh) && IsValid(Mesh->GetSkinnedAsset()))
 	{
 		const auto& ReferenceSkeleton{Mesh->GetSkinnedAsset()->GetRefSkeleton()};
-		const auto PelvisBoneIndex{ReferenceSkeleton.FindBoneIndex(UAlsConstants::PelvisBoneName())};
+
+		PelvisBoneIndex = ReferenceSkeleton.FindBoneIndex(UAlsConstants::PelvisBoneName());
+		FootLeftIkBoneIndex = ReferenceSkeleton.FindBoneIndex(UAlsConstants::FootLeftIkBoneName());
+		FootRightIkBoneIndex = ReferenceSkeleton.FindBoneIndex(UAlsConstants::FootRightIkBoneName());
+		FootLeftVirtualBoneIndex = ReferenceSkeleton.FindBoneIndex(UAlsConstants::FootLeftVirtualBoneName());
+		FootRightVirtualBoneIndex = ReferenceSkeleton.FindBoneIndex(UAlsConstants::FootRightVirtualBoneName());
 
 		static const auto GetThighAxis{
 			[](const FReferenceSkeleton& ReferenceSkeleton, const FName FootBoneName,
-			   const int32 PelvisBoneIndex, FVector3f& ThighAxisPelvisSpace)
+			   const int32 PelvisIndex, FVector3f& ThighAxisPelvisSpace)
 			{
 				auto ParentBoneIndex{ReferenceSkeleton.FindBoneIndex(FootBoneName)};
 				if (ParentBoneIndex < 0)
@@ -67,7 +85,7 @@ void UAlsAnimationInstance::NativeInitializeAnimation()
 						return;
 					}
 
-					if (NextParentBoneIndex == PelvisBoneIndex)
+					if (NextParentBoneIndex == PelvisIndex)
 					{
 						break;
 					}
@@ -93,6 +111,26 @@ void UAlsAnimationInstance::NativeBeginPlay()
 
 	ALS_ENSURE(IsValid(Settings));
 	ALS_ENSURE(IsValid(Character));
+
+	if (IsValid(Settings) && Settings->FootLock.bAllowBatchedFootLock)
+	{
+		auto* FootLockSubsystem{GetWorld()->GetSubsystem<UAlsFootLockSubsystem>()};
+		if (IsValid(FootLockSubsystem))
+		{
+			FootLockSubsystem->RegisterAnimationInstance(this);
+		}
+	}
+}
+
+void UAlsAnimationInstance::NativeUninitializeAnimation()
+{
+	auto* FootLockSubsystem{IsValid(GetWorld()) ? GetWorld()->GetSubsystem<UAlsFootLockSubsystem>() : nullptr};
+	if (IsValid(FootLockSubsystem))
+	{
+		FootLockSubsystem->UnregisterAnimationInstance(this);
+	}
+
+	Super::NativeUninitializeAnimation();
 }
 
 void UAlsAnimationInstance::NativeUpdateAnimation(const float DeltaTime)
@@ -100,6 +138,7 @@ void UAlsAnimationInstance::NativeUpdateAnimation(const float DeltaTime)
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsAnimationInstance::NativeUpdateAnimation"),
 	                            STAT_UAlsAnimationInstance_NativeUpdateAnimation, STATGROUP_Als)
 	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+	CSV_SCOPED_TIMING_STAT(Als, AnimationUpdate);
 
 	Super::NativeUpdateAnimation(DeltaTime);
 
@@ -137,6 +176,17 @@ void UAlsAnimationInstance::NativeUpdateAnimation(const float DeltaTime)
 	bDisplayDebugTraces = UAlsDebugUtility::ShouldDisplayDebugForActor(Character, UAlsConstants::TracesDebugDisplayName());
 #endif
 
+	RefreshDormancyOnGameThread(DeltaTime);
+
+	if (DormancyState.bDormant)
+	{
+		return;
+	}
+
+#if STATS
+	const auto StartCycles{FPlatformTime::Cycles64()};
+#endif
+
 	ViewMode = Character->GetViewMode();
 	LocomotionMode = Character->GetLocomotionMode();
 	RotationMode = Character->GetRotationMode();
@@ -152,6 +202,7 @@ void UAlsAnimationInstance::NativeUpdateAnimation(const float DeltaTime)
 
 	const auto PreviousLocation{LocomotionState.LocationWorldSpace};
 
+	RefreshAnimationLodOnGameThread();
 	RefreshMovementBaseOnGameThread();
 	RefreshViewOnGameThread();
 	RefreshLocomotionOnGameThread();
@@ -165,6 +216,10 @@ void UAlsAnimationInstance::NativeUpdateAnimation(const float DeltaTime)
 	{
 		MarkTeleported();
 	}
+
+#if STATS
+	DormancyState.UpdateTime = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+#endif
 }
 
 void UAlsAnimationInstance::NativeThreadSafeUpdateAnimation(const float DeltaTime)
@@ -172,6 +227,7 @@ void UAlsAnimationInstance::NativeThreadSafeUpdateAnimation(const float DeltaTim
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsAnimationInstance::NativeThreadSafeUpdateAnimation"),
 	                            STAT_UAlsAnimationInstance_NativeThreadSafeUpdateAnimation, STATGROUP_Als)
 	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+	CSV_SCOPED_TIMING_STAT(Als, AnimationThreadSafeUpdate);
 
 	Super::NativeThreadSafeUpdateAnimation(DeltaTime);
 
@@ -180,15 +236,43 @@ void UAlsAnimationInstance::NativeThreadSafeUpdateAnimation(const float DeltaTim
 		return;
 	}
 
+	if (DormancyState.bDormant)
+	{
+		// Mark these states as updated so that their refresh functions called from the animation blueprint are skipped.
+
+		DynamicTransitionsState.bUpdatedThisFrame = true;
+		RotateInPlaceState.bUpdatedThisFrame = true;
+		TurnInPlaceState.bUpdatedThisFrame = true;
+
+		INC_DWORD_STAT(STAT_Als_DormantAnimationInstances);
+		INC_FLOAT_STAT_BY(STAT_Als_DormantAnimationInstancesTimeSaved, DormancyState.UpdateTime);
+		return;
+	}
+
+#if STATS
+	const auto StartCycles{FPlatformTime::Cycles64()};
+#endif
+
 	DynamicTransitionsState.bUpdatedThisFrame = false;
 	RotateInPlaceState.bUpdatedThisFrame = false;
 	TurnInPlaceState.bUpdatedThisFrame = false;
 
+	RefreshCurves();
 	RefreshLayering();
 	RefreshPose();
 	RefreshView(DeltaTime);
-	RefreshFeet(DeltaTime);
+
+	if (FeetBatchRefreshFrame != GFrameCounter && !GetAnimationLodLevel().bDisableFeet)
+	{
+		RefreshFeetTargets(GetProxyOnAnyThread<FAnimInstanceProxy>().GetComponentTransform());
+		RefreshFeet(DeltaTime);
+	}
+
 	RefreshTransitions();
+
+#if STATS
+	DormancyState.UpdateTime += FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+#endif
 }
 
 void UAlsAnimationInstance::NativePostUpdateAnimation()
@@ -256,8 +340,176 @@ FAlsControlRigInput UAlsAnimationInstance::GetControlRigInput() const
 	};
 }
 
+void UAlsAnimationInstance::RefreshDormancyOnGameThread(const float DeltaTime)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsAnimationInstance::RefreshDormancyOnGameThread"),
+	                            STAT_UAlsAnimationInstance_RefreshDormancyOnGameThread, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
+	check(IsInGameThread())
+
+	const auto& CharacterLocomotion{Character->GetLocomotionState()};
+	const auto CharacterLocation{Character->GetActorLocation()};
+	const auto CharacterRotation{Character->GetActorRotation()};
+	const auto& CharacterViewRotation{Character->GetViewState().Rotation};
+
+	// The character is considered idle if nothing that affects the animation instance's state has changed since the previous
+	// update, and all the animations that depend on it have finished. Tags are compared before they are updated for this frame.
+
+	const auto bIdle{
+		Settings->General.bAllowDormancy && !bPendingUpdate && (FeetState.bValid || GetAnimationLodLevel().bDisableFeet) &&
+		ViewMode == Character->GetViewMode() && LocomotionMode == Character->GetLocomotionMode() &&
+		RotationMode == Character->GetRotationMode() && Stance == Character->GetStance() &&
+		Gait == Character->GetGait() && OverlayMode == Character->GetOverlayMode() &&
+		LocomotionAction == Character->GetLocomotionAction() && !LocomotionAction.IsValid() &&
+		LocomotionMode == AlsLocomotionModeTags::Grounded && RotationMode != AlsRotationModeTags::Aiming &&
+		!GroundedEntryMode.IsValid() && !CharacterLocomotion.bHasInput && !CharacterLocomotion.bHasVelocity &&
+		!CharacterLocomotion.bMoving && !IsAnyMontagePlaying() &&
+		!IsValid(TransitionsState.QueuedTransitionSequence) && !TransitionsState.bStopTransitionsQueued &&
+		TurnInPlaceState.ActivationDelay <= 0.0f && !IsValid(TurnInPlaceState.QueuedSettings) &&
+		!RotateInPlaceState.bRotatingLeft && !RotateInPlaceState.bRotatingRight &&
+		CharacterLocation.Equals(DormancyState.Location) && CharacterRotation.Equals(DormancyState.Rotation) &&
+		CharacterViewRotation.Equals(DormancyState.ViewRotation, Settings->General.DormancyViewAngleThreshold)
+	};
+
+	if (!bIdle)
+	{
+		DormancyState.bDormant = false;
+		DormancyState.IdleTime = 0.0f;
+		DormancyState.Location = CharacterLocation;
+		DormancyState.Rotation = CharacterRotation;
+		DormancyState.ViewRotation = CharacterViewRotation;
+		return;
+	}
+
+	DormancyState.IdleTime += DeltaTime;
+	DormancyState.bDormant = DormancyState.IdleTime >= Settings->General.DormancyDelay;
+}
+
+void UAlsAnimationInstance::RefreshAnimationLodOnGameThread()
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsAnimationInstance::RefreshAnimationLodOnGameThread"),
+	                            STAT_UAlsAnimationInstance_RefreshAnimationLodOnGameThread, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
+	check(IsInGameThread())
+
+	const auto NewLevel{CalculateAnimationLodLevel()};
+
+	if (NewLevel != AnimationLodLevel)
+	{
+		AnimationLodLevel = NewLevel;
+		ApplyAnimationLodFallbacks();
+	}
+
+	if (AnimationLodLevel >= 0)
+	{
+		INC_DWORD_STAT(STAT_Als_ReducedLodAnimationInstances);
+	}
+}
+
+int32 UAlsAnimationInstance::CalculateAnimationLodLevel() const
+{
+	const auto& Levels{Settings->AnimationLod.Levels};
+
+	if (!Settings->AnimationLod.bAllowAnimationLod || Levels.IsEmpty() || bPendingUpdate)
+	{
+		return INDEX_NONE;
+	}
+
+	const auto* Mesh{GetSkelMeshComponent()};
+	const auto MeshLod{Mesh->GetPredictedLODLevel()};
+
+	// The screen size is only known if the mesh has a render state, so this condition is ignored on dedicated servers.
+	const auto* MeshObject{Mesh->MeshObject};
+	const auto SignificanceTier{Character->GetSignificanceState().Tier};
+
+	for (auto i{Levels.Num() - 1}; i >= 0; i--)
+	{
+		const auto& Level{Levels[i]};
+
+		if ((Level.MinMeshLod >= 0 && MeshLod >= Level.MinMeshLod) ||
+		    (Level.MaxScreenSize > 0.0f && MeshObject != nullptr && MeshObject->MaxDistanceFactor < Level.MaxScreenSize) ||
+		    (Level.bUseSignificanceTier && SignificanceTier >= Level.SignificanceTier))
+		{
+			return i;
+		}
+	}
+
+	return INDEX_NONE;
+}
+
+void UAlsAnimationInstance::ApplyAnimationLodFallbacks()
+{
+	// The disabled features are no longer refreshed, so it's enough to set their fallback values once when the level changes.
+
+	const auto& Level{GetAnimationLodLevel()};
+
+	if (Level.Fallback == EAlsAnimationLodFallback::Reset)
+	{
+		if (Level.bDisableHead)
+		{
+			HeadState = {};
+		}
+
+		if (Level.bDisableSpine)
+		{
+			SpineState = {};
+		}
+
+		if (Level.bDisableLean)
+		{
+			LeanState = {};
+		}
+
+		if (Level.bDisableGroundPrediction)
+		{
+			InAirState.GroundPredictionAmount = 0.0f;
+		}
+	}
+
+	if (Level.bDisableFeet)
+	{
+		// Once the feet are enabled again, they become valid in the same way as after the first update.
+
+		FeetState.bValid = false;
+		FeetState.bBecameValid = false;
+		FeetState.Left.LockAmount = 0.0f;
+		FeetState.Right.LockAmount = 0.0f;
+	}
+
+	if (Level.bDisableDynamicTransitions)
+	{
+		DynamicTransitionsState.FrameDelay = 0;
+	}
+
+	if (Level.bDisableRotateInPlace)
+	{
+		RotateInPlaceState.bRotatingLeft = false;
+		RotateInPlaceState.bRotatingRight = false;
+	}
+
+	if (Level.bDisableTurnInPlace)
+	{
+		TurnInPlaceState.ActivationDelay = 0.0f;
+	}
+}
+
+const FAlsAnimationLodLevel& UAlsAnimationInstance::GetAnimationLodLevel() const
+{
+	static const FAlsAnimationLodLevel FullDetailLevel;
+
+	return IsValid(Settings) && Settings->AnimationLod.Levels.IsValidIndex(AnimationLodLevel)
+		       ? Settings->AnimationLod.Levels[AnimationLodLevel]
+		       : FullDetailLevel;
+}
+
 void UAlsAnimationInstance::RefreshMovementBaseOnGameThread()
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsAnimationInstance::RefreshMovementBaseOnGameThread"),
+	                            STAT_UAlsAnimationInstance_RefreshMovementBaseOnGameThread, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	const auto& BasedMovement{Character->GetBasedMovement()};
 
 	if (BasedMovement.MovementBaseInterfaceData != MovementBase.MovementBaseInterfaceData ||
@@ -285,79 +537,68 @@ void UAlsAnimationInstance::RefreshMovementBaseOnGameThread()
 		                             : FRotator::ZeroRotator;
 }
 
-void UAlsAnimationInstance::RefreshLayering()
+void UAlsAnimationInstance::RefreshCurves()
 {
-	const auto& Curves{
-		AlsGetAnimationCurvesAccessor::Access(GetProxyOnAnyThread<FAnimInstanceProxy>(), EAnimCurveType::AttributeCurve)
-	};
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsAnimationInstance::RefreshCurves"), STAT_UAlsAnimationInstance_RefreshCurves, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
 
-	static const auto GetCurveValue{
-		[](const TMap<FName, float>& Curves, const FName CurveName) -> float
-		{
-			const auto* Value{Curves.Find(CurveName)};
+	CurveCache.Refresh(AlsGetAnimationCurvesAccessor::Access(GetProxyOnAnyThread<FAnimInstanceProxy>(),
+	                                                         EAnimCurveType::AttributeCurve));
+}
 
-			return Value != nullptr ? *Value : 0.0f;
-		}
-	};
+void UAlsAnimationInstance::RefreshLayering()
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsAnimationInstance::RefreshLayering"), STAT_UAlsAnimationInstance_RefreshLayering, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
 
-	LayeringState.HeadBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerHeadCurveName());
-	LayeringState.HeadAdditiveBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerHeadAdditiveCurveName());
-	LayeringState.HeadSlotBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerHeadSlotCurveName());
+	LayeringState.HeadBlendAmount = CurveCache.GetValue(EAlsAnimationCurve::LayerHead);
+	LayeringState.HeadAdditiveBlendAmount = CurveCache.GetValue(EAlsAnimationCurve::LayerHeadAdditive);
+	LayeringState.HeadSlotBlendAmount = CurveCache.GetValue(EAlsAnimationCurve::LayerHeadSlot);
 
 	// The mesh space blend will always be 1 unless the local space blend is 1.
 
-	LayeringState.ArmLeftBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerArmLeftCurveName());
-	LayeringState.ArmLeftAdditiveBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerArmLeftAdditiveCurveName());
-	LayeringState.ArmLeftSlotBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerArmLeftSlotCurveName());
-	LayeringState.ArmLeftLocalSpaceBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerArmLeftLocalSpaceCurveName());
+	LayeringState.ArmLeftBlendAmount = CurveCache.GetValue(EAlsAnimationCurve::LayerArmLeft);
+	LayeringState.ArmLeftAdditiveBlendAmount = CurveCache.GetValue(EAlsAnimationCurve::LayerArmLeftAdditive);
+	LayeringState.ArmLeftSlotBlendAmount = CurveCache.GetValue(EAlsAnimationCurve::LayerArmLeftSlot);
+	LayeringState.ArmLeftLocalSpaceBlendAmount = CurveCache.GetValue(EAlsAnimationCurve::LayerArmLeftLocalSpace);
 	LayeringState.ArmLeftMeshSpaceBlendAmount = !FAnimWeight::IsFullWeight(LayeringState.ArmLeftLocalSpaceBlendAmount);
 
 	// The mesh space blend will always be 1 unless the local space blend is 1.
 
-	LayeringState.ArmRightBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerArmRightCurveName());
-	LayeringState.ArmRightAdditiveBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerArmRightAdditiveCurveName());
-	LayeringState.ArmRightSlotBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerArmRightSlotCurveName());
-	LayeringState.ArmRightLocalSpaceBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerArmRightLocalSpaceCurveName());
+	LayeringState.ArmRightBlendAmount = CurveCache.GetValue(EAlsAnimationCurve::LayerArmRight);
+	LayeringState.ArmRightAdditiveBlendAmount = CurveCache.GetValue(EAlsAnimationCurve::LayerArmRightAdditive);
+	LayeringState.ArmRightSlotBlendAmount = CurveCache.GetValue(EAlsAnimationCurve::LayerArmRightSlot);
+	LayeringState.ArmRightLocalSpaceBlendAmount = CurveCache.GetValue(EAlsAnimationCurve::LayerArmRightLocalSpace);
 	LayeringState.ArmRightMeshSpaceBlendAmount = !FAnimWeight::IsFullWeight(LayeringState.ArmRightLocalSpaceBlendAmount);
 
-	LayeringState.HandLeftBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerHandLeftCurveName());
-	LayeringState.HandRightBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerHandRightCurveName());
+	LayeringState.HandLeftBlendAmount = CurveCache.GetValue(EAlsAnimationCurve::LayerHandLeft);
+	LayeringState.HandRightBlendAmount = CurveCache.GetValue(EAlsAnimationCurve::LayerHandRight);
 
-	LayeringState.SpineBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerSpineCurveName());
-	LayeringState.SpineAdditiveBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerSpineAdditiveCurveName());
-	LayeringState.SpineSlotBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerSpineSlotCurveName());
+	LayeringState.SpineBlendAmount = CurveCache.GetValue(EAlsAnimationCurve::LayerSpine);
+	LayeringState.SpineAdditiveBlendAmount = CurveCache.GetValue(EAlsAnimationCurve::LayerSpineAdditive);
+	LayeringState.SpineSlotBlendAmount = CurveCache.GetValue(EAlsAnimationCurve::LayerSpineSlot);
 
-	LayeringState.PelvisBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerPelvisCurveName());
-	LayeringState.PelvisSlotBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerPelvisSlotCurveName());
+	LayeringState.PelvisBlendAmount = CurveCache.GetValue(EAlsAnimationCurve::LayerPelvis);
+	LayeringState.PelvisSlotBlendAmount = CurveCache.GetValue(EAlsAnimationCurve::LayerPelvisSlot);
 
-	LayeringState.LegsBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerLegsCurveName());
-	LayeringState.LegsSlotBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerLegsSlotCurveName());
+	LayeringState.LegsBlendAmount = CurveCache.GetValue(EAlsAnimationCurve::LayerLegs);
+	LayeringState.LegsSlotBlendAmount = CurveCache.GetValue(EAlsAnimationCurve::LayerLegsSlot);
 }
 
 void UAlsAnimationInstance::RefreshPose()
 {
-	const auto& Curves{
-		AlsGetAnimationCurvesAccessor::Access(GetProxyOnAnyThread<FAnimInstanceProxy>(), EAnimCurveType::AttributeCurve)
-	};
-
-	static const auto GetCurveValue{
-		[](const TMap<FName, float>& Curves, const FName CurveName) -> float
-		{
-			const auto* Value{Curves.Find(CurveName)};
-
-			return Value != nullptr ? *Value : 0.0f;
-		}
-	};
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsAnimationInstance::RefreshPose"), STAT_UAlsAnimationInstance_RefreshPose, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
 
-	PoseState.GroundedAmount = GetCurveValue(Curves, UAlsConstants::PoseGroundedCurveName());
-	PoseState.InAirAmount = GetCurveValue(Curves, UAlsConstants::PoseInAirCurveName());
+	PoseState.GroundedAmount = CurveCache.GetValue(EAlsAnimationCurve::PoseGrounded);
+	PoseState.InAirAmount = CurveCache.GetValue(EAlsAnimationCurve::PoseInAir);
 
-	PoseState.StandingAmount = GetCurveValue(Curves, UAlsConstants::PoseStandingCurveName());
-	PoseState.CrouchingAmount = GetCurveValue(Curves, UAlsConstants::PoseCrouchingCurveName());
+	PoseState.StandingAmount = CurveCache.GetValue(EAlsAnimationCurve::PoseStanding);
+	PoseState.CrouchingAmount = CurveCache.GetValue(EAlsAnimationCurve::PoseCrouching);
 
-	PoseState.MovingAmount = GetCurveValue(Curves, UAlsConstants::PoseMovingCurveName());
+	PoseState.MovingAmount = CurveCache.GetValue(EAlsAnimationCurve::PoseMoving);
 
-	PoseState.GaitAmount = FMath::Clamp(GetCurveValue(Curves, UAlsConstants::PoseGaitCurveName()), 0.0f, 3.0f);
+	PoseState.GaitAmount = FMath::Clamp(CurveCache.GetValue(EAlsAnimationCurve::PoseGait), 0.0f, 3.0f);
 	PoseState.GaitWalkingAmount = UAlsMath::Clamp01(PoseState.GaitAmount);
 	PoseState.GaitRunningAmount = UAlsMath::Clamp01(PoseState.GaitAmount - 1.0f);
 	PoseState.GaitSprintingAmount = UAlsMath::Clamp01(PoseState.GaitAmount - 2.0f);
@@ -376,6 +617,10 @@ void UAlsAnimationInstance::RefreshPose()
 
 void UAlsAnimationInstance::RefreshViewOnGameThread()
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsAnimationInstance::RefreshViewOnGameThread"),
+	                            STAT_UAlsAnimationInstance_RefreshViewOnGameThread, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	check(IsInGameThread())
 
 	const auto& View{Character->GetViewState()};
@@ -386,6 +631,9 @@ void UAlsAnimationInstance::RefreshViewOnGameThread()
 
 void UAlsAnimationInstance::RefreshView(const float DeltaTime)
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsAnimationInstance::RefreshView"), STAT_UAlsAnimationInstance_RefreshView, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	if (!LocomotionAction.IsValid())
 	{
 		ViewState.YawAngle = FMath::UnwindDegrees(UE_REAL_TO_FLOAT(
@@ -397,12 +645,15 @@ void UAlsAnimationInstance::RefreshView(const float DeltaTime)
 		ViewState.PitchAmount = 0.5f - ViewState.PitchAngle / 180.0f;
 	}
 
-	const auto ViewAmount{1.0f - GetCurveValueClamped01(UAlsConstants::ViewBlockCurveName())};
-	const auto AimingAmount{GetCurveValueClamped01(UAlsConstants::PoseAimingCurveName())};
+	const auto ViewAmount{1.0f - CurveCache.GetValueClamped01(EAlsAnimationCurve::ViewBlock)};
+	const auto AimingAmount{CurveCache.GetValueClamped01(EAlsAnimationCurve::PoseAiming)};
 
 	ViewState.HeadBlendAmount = ViewAmount * (1.0f - AimingAmount);
 
-	RefreshSpine(ViewAmount * AimingAmount, DeltaTime);
+	if (!GetAnimationLodLevel().bDisableSpine)
+	{
+		RefreshSpine(ViewAmount * AimingAmount, DeltaTime);
+	}
 }
 
 bool UAlsAnimationInstance::IsSpineRotationAllowed()
@@ -412,6 +663,9 @@ bool UAlsAnimationInstance::IsSpineRotationAllowed()
 
 void UAlsAnimationInstance::RefreshSpine(const float SpineBlendAmount, const float DeltaTime)
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsAnimationInstance::RefreshSpine"), STAT_UAlsAnimationInstance_RefreshSpine, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	if (SpineState.bSpineRotationAllowed != IsSpineRotationAllowed())
 	{
 		SpineState.bSpineRotationAllowed = !SpineState.bSpineRotationAllowed;
@@ -537,7 +791,7 @@ void UAlsAnimationInstance::RefreshHead()
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsAnimationInstance::RefreshHead"), STAT_UAlsAnimationInstance_RefreshHead, STATGROUP_Als)
 	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
 
-	if (!IsValid(Settings))
+	if (DormancyState.bDormant || !IsValid(Settings) || GetAnimationLodLevel().bDisableHead)
 	{
 		return;
 	}
@@ -680,6 +934,10 @@ void UAlsAnimationInstance::RefreshHead()
 
 void UAlsAnimationInstance::RefreshLocomotionOnGameThread()
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsAnimationInstance::RefreshLocomotionOnGameThread"),
+	                            STAT_UAlsAnimationInstance_RefreshLocomotionOnGameThread, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	check(IsInGameThread())
 
 	const auto DeltaTime{GetDeltaSeconds()};
@@ -812,13 +1070,17 @@ void UAlsAnimationInstance::RefreshGrounded()
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsAnimationInstance::RefreshGrounded"), STAT_UAlsAnimationInstance_RefreshGrounded, STATGROUP_Als)
 	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
 
-	if (!IsValid(Settings))
+	if (DormancyState.bDormant || !IsValid(Settings))
 	{
 		return;
 	}
 
 	RefreshVelocityBlend();
-	RefreshGroundedLean();
+
+	if (!GetAnimationLodLevel().bDisableLean)
+	{
+		RefreshGroundedLean();
+	}
 }
 
 FVector3f UAlsAnimationInstance::GetVelocity() const
@@ -849,6 +1111,10 @@ FVector2f UAlsAnimationInstance::GetAccelerationAmount() const
 
 void UAlsAnimationInstance::RefreshVelocityBlend()
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsAnimationInstance::RefreshVelocityBlend"),
+	                            STAT_UAlsAnimationInstance_RefreshVelocityBlend, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	// Calculate and interpolate the velocity blend amounts. This value represents the velocity amount of
 	// the character in each direction (normalized so that diagonals equal 0.5 for each direction) and is
 	// used in a blend multi node to produce better directional blending than a standard blend space.
@@ -902,6 +1168,10 @@ void UAlsAnimationInstance::RefreshVelocityBlend()
 
 void UAlsAnimationInstance::RefreshGroundedLean()
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsAnimationInstance::RefreshGroundedLean"),
+	                            STAT_UAlsAnimationInstance_RefreshGroundedLean, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	const auto TargetLeanAmount{GetAccelerationAmount()};
 
 	if (bPendingUpdate || Settings->General.LeanInterpolationHalfLife <= 0.0f)
@@ -931,12 +1201,12 @@ void UAlsAnimationInstance::RefreshGroundedMovement()
 	                            STAT_UAlsAnimationInstance_RefreshGroundedMovement, STATGROUP_Als)
 	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
 
-	if (!IsValid(Settings))
+	if (DormancyState.bDormant || !IsValid(Settings))
 	{
 		return;
 	}
 
-	GroundedState.HipsDirectionLockAmount = FMath::Clamp(GetCurveValue(UAlsConstants::HipsDirectionLockCurveName()), -1.0f, 1.0f);
+	GroundedState.HipsDirectionLockAmount = FMath::Clamp(CurveCache.GetValue(EAlsAnimationCurve::HipsDirectionLock), -1.0f, 1.0f);
 
 	const auto VelocityYawAngleViewSpace{
 		FMath::UnwindDegrees(UE_REAL_TO_FLOAT(LocomotionState.VelocityYawAngleWorldSpace - ViewState.RotationWorldSpace.Yaw))
@@ -948,6 +1218,10 @@ void UAlsAnimationInstance::RefreshGroundedMovement()
 
 void UAlsAnimationInstance::RefreshMovementDirection(const float VelocityYawAngleViewSpace)
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsAnimationInstance::RefreshMovementDirection"),
+	                            STAT_UAlsAnimationInstance_RefreshMovementDirection, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	// Calculate the movement direction. This value represents the direction in which the character is moving relative to the camera
 	// in view direction and aiming rotation modes. It used in cycle blending to transition to the appropriate directional state.
 
@@ -965,15 +1239,28 @@ void UAlsAnimationInstance::RefreshMovementDirection(const float VelocityYawAngl
 
 void UAlsAnimationInstance::RefreshRotationYawOffsets(const float VelocityYawAngleViewSpace)
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsAnimationInstance::RefreshRotationYawOffsets"),
+	                            STAT_UAlsAnimationInstance_RefreshRotationYawOffsets, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	// Rotation yaw offsets influence the rotation yaw offset curve in the animation graph. It is used to offset the character's
 	// rotation, creating more natural movement. These curves enable precise control of the offset for each movement direction.
 
 	auto& RotationYawOffsets{GroundedState.RotationYawOffsets};
 
-	RotationYawOffsets.ForwardAngle = Settings->Grounded.RotationYawOffsetForwardCurve->GetFloatValue(VelocityYawAngleViewSpace);
-	RotationYawOffsets.BackwardAngle = Settings->Grounded.RotationYawOffsetBackwardCurve->GetFloatValue(VelocityYawAngleViewSpace);
-	RotationYawOffsets.LeftAngle = Settings->Grounded.RotationYawOffsetLeftCurve->GetFloatValue(VelocityYawAngleViewSpace);
-	RotationYawOffsets.RightAngle = Settings->Grounded.RotationYawOffsetRightCurve->GetFloatValue(VelocityYawAngleViewSpace);
+	const auto& Grounded{Settings->Grounded};
+
+	RotationYawOffsets.ForwardAngle = Grounded.RotationYawOffsetForwardBakedCurve.Evaluate(
+		VelocityYawAngleViewSpace, Grounded.RotationYawOffsetForwardCurve);
+
+	RotationYawOffsets.BackwardAngle = Grounded.RotationYawOffsetBackwardBakedCurve.Evaluate(
+		VelocityYawAngleViewSpace, Grounded.RotationYawOffsetBackwardCurve);
+
+	RotationYawOffsets.LeftAngle = Grounded.RotationYawOffsetLeftBakedCurve.Evaluate(
+		VelocityYawAngleViewSpace, Grounded.RotationYawOffsetLeftCurve);
+
+	RotationYawOffsets.RightAngle = Grounded.RotationYawOffsetRightBakedCurve.Evaluate(
+		VelocityYawAngleViewSpace, Grounded.RotationYawOffsetRightCurve);
 }
 
 void UAlsAnimationInstance::InitializeStandingMovement()
@@ -995,7 +1282,7 @@ void UAlsAnimationInstance::RefreshStandingMovement()
 	                            STAT_UAlsAnimationInstance_RefreshStandingMovement, STATGROUP_Als)
 	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
 
-	if (!IsValid(Settings))
+	if (DormancyState.bDormant || !IsValid(Settings))
 	{
 		return;
 	}
@@ -1007,9 +1294,12 @@ void UAlsAnimationInstance::RefreshStandingMovement()
 	// blend independently while still matching the animation speed to the movement speed, preventing the character from needing
 	// to play a half walk + half run blend. The curves are used to map the stride amount to the speed for maximum control.
 
-	StandingState.StrideBlendAmount = FMath::Lerp(Settings->Standing.StrideBlendAmountWalkCurve->GetFloatValue(Speed),
-	                                              Settings->Standing.StrideBlendAmountRunCurve->GetFloatValue(Speed),
-	                                              PoseState.UnweightedGaitRunningAmount);
+	const auto& Standing{Settings->Standing};
+
+	const auto StrideBlendAmountWalk{Standing.StrideBlendAmountWalkBakedCurve.Evaluate(Speed, Standing.StrideBlendAmountWalkCurve)};
+	const auto StrideBlendAmountRun{Standing.StrideBlendAmountRunBakedCurve.Evaluate(Speed, Standing.StrideBlendAmountRunCurve)};
+
+	StandingState.StrideBlendAmount = FMath::Lerp(StrideBlendAmountWalk, StrideBlendAmountRun, PoseState.UnweightedGaitRunningAmount);
 
 	// Calculate the walk run blend amount. This value is used within the blend spaces to blend between walking and running.
 
@@ -1040,7 +1330,7 @@ void UAlsAnimationInstance::RefreshStandingMovement()
 
 	StandingState.PlayRate = FMath::Clamp(WalkRunSprintSpeedAmount / StandingState.StrideBlendAmount, UE_KINDA_SMALL_NUMBER, 3.0f);
 
-	StandingState.SprintBlockAmount = GetCurveValueClamped01(UAlsConstants::SprintBlockCurveName());
+	StandingState.SprintBlockAmount = CurveCache.GetValueClamped01(EAlsAnimationCurve::SprintBlock);
 
 	if (Gait != AlsGaitTags::Sprinting)
 	{
@@ -1082,14 +1372,15 @@ void UAlsAnimationInstance::RefreshCrouchingMovement()
 	                            STAT_UAlsAnimationInstance_RefreshCrouchingMovement, STATGROUP_Als)
 	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
 
-	if (!IsValid(Settings))
+	if (DormancyState.bDormant || !IsValid(Settings))
 	{
 		return;
 	}
 
 	const auto Speed{LocomotionState.Speed / LocomotionState.ScaleWorldSpace};
 
-	CrouchingState.StrideBlendAmount = Settings->Crouching.StrideBlendAmountCurve->GetFloatValue(Speed);
+	CrouchingState.StrideBlendAmount = Settings->Crouching.StrideBlendAmountBakedCurve.Evaluate(
+		Speed, Settings->Crouching.StrideBlendAmountCurve);
 
 	CrouchingState.PlayRate = FMath::Clamp(
 		Speed / (Settings->Crouching.AnimatedCrouchSpeed * CrouchingState.StrideBlendAmount),
@@ -1098,10 +1389,16 @@ void UAlsAnimationInstance::RefreshCrouchingMovement()
 
 void UAlsAnimationInstance::RefreshInAirOnGameThread()
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsAnimationInstance::RefreshInAirOnGameThread"),
+	                            STAT_UAlsAnimationInstance_RefreshInAirOnGameThread, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	check(IsInGameThread())
 
 	InAirState.bJumped = !bPendingUpdate && (InAirState.bJumped || InAirState.bJumpRequested);
 	InAirState.bJumpRequested = false;
+
+	RefreshGroundPredictionOnGameThread();
 }
 
 void UAlsAnimationInstance::RefreshInAir()
@@ -1135,25 +1432,110 @@ void UAlsAnimationInstance::RefreshInAir()
 
 	InAirState.VerticalVelocityWorldSpace = UE_REAL_TO_FLOAT(LocomotionState.VelocityWorldSpace.Z);
 
-	RefreshGroundPrediction();
-	RefreshInAirLean();
+	const auto& AnimationLod{GetAnimationLodLevel()};
+
+	if (!AnimationLod.bDisableGroundPrediction)
+	{
+		RefreshGroundPrediction();
+	}
+
+	if (!AnimationLod.bDisableLean)
+	{
+		RefreshInAirLean();
+	}
+}
+
+void UAlsAnimationInstance::RefreshGroundPredictionOnGameThread()
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsAnimationInstance::RefreshGroundPredictionOnGameThread"),
+	                            STAT_UAlsAnimationInstance_RefreshGroundPredictionOnGameThread, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
+	check(IsInGameThread())
+
+	auto& State{GroundPredictionState};
+
+	if (!Settings->InAir.bUseAsyncGroundPredictionSweep || LocomotionMode != AlsLocomotionModeTags::InAir ||
+	    !GetWorld()->IsGameWorld() || GetAnimationLodLevel().bDisableGroundPrediction)
+	{
+		State.SweepHandle.Invalidate();
+		State.bHasSweepResult = false;
+		return;
+	}
+
+	auto* World{GetWorld()};
+
+	// Receive the result of the sweep started in the previous frame.
+
+	if (State.SweepHandle.IsValid())
+	{
+		FTraceDatum SweepDatum;
+
+		if (World->QueryTraceData(State.SweepHandle, SweepDatum))
+		{
+			State.SweepHandle.Invalidate();
+
+			const auto SweepVector{SweepDatum.End - SweepDatum.Start};
+
+			const auto Hit{
+				SweepDatum.OutHits.IsEmpty() ? FHitResult{SweepDatum.Start, SweepDatum.End} : SweepDatum.OutHits[0]
+			};
+
+			State.bHasSweepResult = true;
+			State.bGroundValid = Hit.bBlockingHit && Hit.ImpactNormal.Z >= LocomotionState.WalkableFloorAngleCos;
+			State.SweepStartLocation = SweepDatum.Start;
+			State.SweepDirection = SweepVector.GetSafeNormal();
+			State.SweepDistance = UE_REAL_TO_FLOAT(SweepVector.Size());
+			State.HitDistance = Hit.Time * State.SweepDistance;
+			State.SweepResultTime = World->GetTimeSeconds();
+
+			DrawGroundPredictionSweepDebug(Hit, State.bGroundValid);
+		}
+		else if (!World->IsTraceHandleValid(State.SweepHandle, false))
+		{
+			State.SweepHandle.Invalidate();
+		}
+	}
+
+	// Start a new sweep only if there is none in progress and the previous result can no longer be reused.
+
+	FVector SweepVector;
+	bool bGroundValid;
+	float HitTime;
+
+	if (State.SweepHandle.IsValid() || !CalculateGroundPredictionSweepVector(SweepVector) ||
+	    TryReuseGroundPredictionSweep(LocomotionState.LocationWorldSpace, SweepVector, bGroundValid, HitTime))
+	{
+		return;
+	}
+
+	ALS_INC_COUNTER(GroundPredictionSceneQueries);
+	State.SweepHandle = World->AsyncSweepByChannel(EAsyncTraceType::Single, LocomotionState.LocationWorldSpace,
+	                                               LocomotionState.LocationWorldSpace + SweepVector, FQuat::Identity,
+	                                               Settings->InAir.GroundPredictionSweepChannel,
+	                                               FCollisionShape::MakeCapsule(LocomotionState.CapsuleRadius,
+	                                                                            LocomotionState.CapsuleHalfHeight),
+	                                               {__FUNCTION__, false, Character}, Settings->InAir.GroundPredictionSweepResponses);
 }
 
 void UAlsAnimationInstance::RefreshGroundPrediction()
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsAnimationInstance::RefreshGroundPrediction"),
+	                            STAT_UAlsAnimationInstance_RefreshGroundPrediction, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	// Calculate the ground prediction weight by tracing in the velocity direction to find a walkable surface the character
 	// is falling toward and getting the "time" (range from 0 to 1, 1 being maximum, 0 being about to ground) till impact.
 	// The ground prediction amount curve is used to control how the time affects the final amount for a smooth blend.
 
-	static constexpr auto VerticalVelocityThreshold{-200.0f};
-
-	if (InAirState.VerticalVelocityWorldSpace > VerticalVelocityThreshold)
+	FVector SweepVector;
+	if (!CalculateGroundPredictionSweepVector(SweepVector))
 	{
 		InAirState.GroundPredictionAmount = 0.0f;
 		return;
 	}
 
-	const auto AllowanceAmount{1.0f - GetCurveValueClamped01(UAlsConstants::GroundPredictionBlockCurveName())};
+	const auto AllowanceAmount{1.0f - CurveCache.GetValueClamped01(EAlsAnimationCurve::GroundPredictionBlock)};
 	if (AllowanceAmount <= UE_KINDA_SMALL_NUMBER)
 	{
 		InAirState.GroundPredictionAmount = 0.0f;
@@ -1162,9 +1544,53 @@ void UAlsAnimationInstance::RefreshGroundPrediction()
 
 	const auto SweepStartLocation{LocomotionState.LocationWorldSpace};
 
+	bool bGroundValid;
+	float HitTime;
+
+	if (Settings->InAir.bUseAsyncGroundPredictionSweep)
+	{
+		// The sweep is performed in RefreshGroundPredictionOnGameThread(), so if its result can't be
+		// reused, keep the current amount until the result of the new sweep becomes available.
+
+		if (!TryReuseGroundPredictionSweep(SweepStartLocation, SweepVector, bGroundValid, HitTime))
+		{
+			return;
+		}
+	}
+	else
+	{
+		FHitResult Hit;
+		ALS_INC_COUNTER(GroundPredictionSceneQueries);
+		GetWorld()->SweepSingleByChannel(Hit, SweepStartLocation, SweepStartLocation + SweepVector,
+		                                 FQuat::Identity, Settings->InAir.GroundPredictionSweepChannel,
+		                                 FCollisionShape::MakeCapsule(LocomotionState.CapsuleRadius, LocomotionState.CapsuleHalfHeight),
+		                                 {__FUNCTION__, false, Character}, Settings->InAir.GroundPredictionSweepResponses);
+
+		// Consider the ground valid, even if the trace started in penetration.
+
+		bGroundValid = Hit.bBlockingHit && Hit.ImpactNormal.Z >= LocomotionState.WalkableFloorAngleCos;
+		HitTime = Hit.Time;
+
+		DrawGroundPredictionSweepDebug(Hit, bGroundValid);
+	}
+
+	InAirState.GroundPredictionAmount = bGroundValid
+		                                    ? Settings->InAir.GroundPredictionAmountBakedCurve.Evaluate(
+			                                      HitTime, Settings->InAir.GroundPredictionAmountCurve) * AllowanceAmount
+		                                    : 0.0f;
+}
+
+bool UAlsAnimationInstance::CalculateGroundPredictionSweepVector(FVector& SweepVector) const
+{
 	static constexpr auto MinVerticalVelocity{-4000.0f};
 	static constexpr auto MaxVerticalVelocity{-200.0f};
 
+	const auto VerticalVelocity{UE_REAL_TO_FLOAT(LocomotionState.VelocityWorldSpace.Z)};
+	if (VerticalVelocity > MaxVerticalVelocity)
+	{
+		return false;
+	}
+
 	auto VelocityDirection{LocomotionState.VelocityWorldSpace};
 	VelocityDirection.Z = FMath::Clamp(VelocityDirection.Z, MinVerticalVelocity, MaxVerticalVelocity);
 	VelocityDirection.Normalize();
@@ -1172,23 +1598,65 @@ void UAlsAnimationInstance::RefreshGroundPrediction()
 	static constexpr auto MinSweepDistance{150.0f};
 	static constexpr auto MaxSweepDistance{2000.0f};
 
-	const auto SweepVector{
-		VelocityDirection * FMath::GetMappedRangeValueClamped(
-			FVector2f{MaxVerticalVelocity, MinVerticalVelocity},
-			FVector2f{MinSweepDistance, MaxSweepDistance},
-			InAirState.VerticalVelocityWorldSpace) * LocomotionState.ScaleWorldSpace
-	};
+	SweepVector = VelocityDirection * FMath::GetMappedRangeValueClamped(
+		              FVector2f{MaxVerticalVelocity, MinVerticalVelocity},
+		              FVector2f{MinSweepDistance, MaxSweepDistance},
+		              VerticalVelocity) * LocomotionState.ScaleWorldSpace;
+
+	return true;
+}
+
+bool UAlsAnimationInstance::TryReuseGroundPredictionSweep(const FVector& SweepStartLocation, const FVector& SweepVector,
+                                                          bool& bGroundValid, float& HitTime) const
+{
+	const auto& State{GroundPredictionState};
 
-	FHitResult Hit;
-	GetWorld()->SweepSingleByChannel(Hit, SweepStartLocation, SweepStartLocation + SweepVector,
-	                                 FQuat::Identity, Settings->InAir.GroundPredictionSweepChannel,
-	                                 FCollisionShape::MakeCapsule(LocomotionState.CapsuleRadius, LocomotionState.CapsuleHalfHeight),
-	                                 {__FUNCTION__, false, Character}, Settings->InAir.GroundPredictionSweepResponses);
+	static constexpr auto MaxSweepResultAge{0.25f};
 
-	// Consider the ground valid, even if the trace started in penetration.
+	if (!State.bHasSweepResult || GetWorld()->GetTimeSeconds() - State.SweepResultTime > MaxSweepResultAge)
+	{
+		return false;
+	}
+
+	const auto SweepDistance{UE_REAL_TO_FLOAT(SweepVector.Size())};
+
+	if (SweepDistance <= UE_KINDA_SMALL_NUMBER ||
+	    (SweepVector | State.SweepDirection) < SweepDistance * Settings->InAir.GroundPredictionSweepReuseAngleThresholdCos)
+	{
+		return false;
+	}
+
+	// Extrapolate the previous sweep by moving its start location along the sweep direction to the current location.
+	// This is only valid while the character stays close to the line of the previous sweep.
+
+	const auto Offset{SweepStartLocation - State.SweepStartLocation};
+	const auto TraveledDistance{UE_REAL_TO_FLOAT(Offset | State.SweepDirection)};
 
-	const auto bGroundValid{Hit.bBlockingHit && Hit.ImpactNormal.Z >= LocomotionState.WalkableFloorAngleCos};
+	if ((Offset - State.SweepDirection * TraveledDistance).SizeSquared() > FMath::Square(LocomotionState.CapsuleRadius * 0.5f))
+	{
+		return false;
+	}
 
+	if (!State.bGroundValid)
+	{
+		// Nothing was hit, so the result remains valid only as long as the current sweep doesn't reach beyond the previous one.
+
+		bGroundValid = false;
+		HitTime = 1.0f;
+
+		return TraveledDistance + SweepDistance <= State.SweepDistance;
+	}
+
+	const auto RemainingDistance{State.HitDistance - TraveledDistance};
+
+	bGroundValid = RemainingDistance <= SweepDistance;
+	HitTime = FMath::Clamp(RemainingDistance / SweepDistance, 0.0f, 1.0f);
+
+	return true;
+}
+
+void UAlsAnimationInstance::DrawGroundPredictionSweepDebug(const FHitResult& Hit, const bool bGroundValid) const
+{
 #if WITH_EDITORONLY_DATA && ENABLE_DRAW_DEBUG
 	if (bDisplayDebugTraces)
 	{
@@ -1210,14 +1678,13 @@ void UAlsAnimationInstance::RefreshGroundPrediction()
 		}
 	}
 #endif
-
-	InAirState.GroundPredictionAmount = bGroundValid
-		                                    ? Settings->InAir.GroundPredictionAmountCurve->GetFloatValue(Hit.Time) * AllowanceAmount
-		                                    : 0.0f;
 }
 
 void UAlsAnimationInstance::RefreshInAirLean()
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsAnimationInstance::RefreshInAirLean"), STAT_UAlsAnimationInstance_RefreshInAirLean, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	// Use the velocity direction and amount to determine how much the character should lean
 	// while in the air. The lean amount curve uses the vertical velocity as a multiplier to
 	// smoothly reverse the leaning direction when transitioning from moving upward to downward.
@@ -1225,7 +1692,8 @@ void UAlsAnimationInstance::RefreshInAirLean()
 	static constexpr auto ReferenceSpeed{350.0f};
 
 	const auto TargetLeanAmount{
-		GetVelocity() / ReferenceSpeed * Settings->InAir.LeanAmountCurve->GetFloatValue(InAirState.VerticalVelocityWorldSpace)
+		GetVelocity() / ReferenceSpeed * Settings->InAir.LeanAmountBakedCurve.Evaluate(InAirState.VerticalVelocityWorldSpace,
+		                                                                                 Settings->InAir.LeanAmountCurve)
 	};
 
 	if (bPendingUpdate || Settings->General.LeanInterpolationHalfLife <= 0.0f)
@@ -1246,8 +1714,34 @@ void UAlsAnimationInstance::RefreshFeetOnGameThread()
 {
 	check(IsInGameThread())
 
-	const auto* Mesh{GetSkelMeshComponent()};
-	const auto PelvisTransform{Mesh->GetSocketTransform(UAlsConstants::PelvisBoneName(), RTS_Component)};
+	// Read the bone transforms from the last evaluated pose directly by the bone indices. This gives the same result as
+	// USkinnedMeshComponent::GetSocketTransform(), but without the name lookups.
+
+	const auto& ComponentSpaceTransforms{GetSkelMeshComponent()->GetComponentSpaceTransforms()};
+
+	static const auto GetBoneTransform{
+		[](const TArray<FTransform>& Transforms, const int32 BoneIndex)
+		{
+			return Transforms.IsValidIndex(BoneIndex) ? Transforms[BoneIndex] : FTransform::Identity;
+		}
+	};
+
+	PelvisTransformComponentSpace = GetBoneTransform(ComponentSpaceTransforms, PelvisBoneIndex);
+
+	FootLeftTargetTransformComponentSpace = GetBoneTransform(ComponentSpaceTransforms, Settings->General.bUseFootIkBones
+		                                                                                   ? FootLeftIkBoneIndex
+		                                                                                   : FootLeftVirtualBoneIndex);
+
+	FootRightTargetTransformComponentSpace = GetBoneTransform(ComponentSpaceTransforms, Settings->General.bUseFootIkBones
+		                                                                                    ? FootRightIkBoneIndex
+		                                                                                    : FootRightVirtualBoneIndex);
+}
+
+void UAlsAnimationInstance::RefreshFeetTargets(const FTransform& ComponentTransform)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsAnimationInstance::RefreshFeetTargets"),
+	                            STAT_UAlsAnimationInstance_RefreshFeetTargets, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
 
 	if (bPendingUpdate)
 	{
@@ -1260,7 +1754,7 @@ void UAlsAnimationInstance::RefreshFeetOnGameThread()
 		// Ideally, we should use USkinnedMeshComponent.::bHasValidBoneTransform here instead, but it can't be accessed.
 		// TODO Wait for https://github.com/EpicGames/UnrealEngine/pull/14322 to be merged into the engine.
 
-		if (PelvisTransform.EqualsNoScale(FTransform::Identity))
+		if (PelvisTransformComponentSpace.EqualsNoScale(FTransform::Identity))
 		{
 			return;
 		}
@@ -1273,22 +1767,14 @@ void UAlsAnimationInstance::RefreshFeetOnGameThread()
 		FeetState.bBecameValid = false;
 	}
 
-	FeetState.PelvisRotation = FQuat4f{PelvisTransform.GetRotation()};
+	FeetState.PelvisRotation = FQuat4f{PelvisTransformComponentSpace.GetRotation()};
 
-	const auto FootLeftTargetTransform{
-		Mesh->GetSocketTransform(Settings->General.bUseFootIkBones
-			                         ? UAlsConstants::FootLeftIkBoneName()
-			                         : UAlsConstants::FootLeftVirtualBoneName())
-	};
+	const auto FootLeftTargetTransform{FootLeftTargetTransformComponentSpace * ComponentTransform};
 
 	FeetState.Left.TargetLocationWorldSpace = FootLeftTargetTransform.GetLocation();
 	FeetState.Left.TargetRotationWorldSpace = FootLeftTargetTransform.GetRotation();
 
-	const auto FootRightTargetTransform{
-		Mesh->GetSocketTransform(Settings->General.bUseFootIkBones
-			                         ? UAlsConstants::FootRightIkBoneName()
-			                         : UAlsConstants::FootRightVirtualBoneName())
-	};
+	const auto FootRightTargetTransform{FootRightTargetTransformComponentSpace * ComponentTransform};
 
 	FeetState.Right.TargetLocationWorldSpace = FootRightTargetTransform.GetLocation();
 	FeetState.Right.TargetRotationWorldSpace = FootRightTargetTransform.GetRotation();
@@ -1296,49 +1782,69 @@ void UAlsAnimationInstance::RefreshFeetOnGameThread()
 
 void UAlsAnimationInstance::RefreshFeet(const float DeltaTime)
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsAnimationInstance::RefreshFeet"), STAT_UAlsAnimationInstance_RefreshFeet, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	if (!FeetState.bValid)
 	{
 		return;
 	}
 
-	FeetState.FootPlantedAmount = FMath::Clamp(GetCurveValue(UAlsConstants::FootPlantedCurveName()), -1.0f, 1.0f);
-	FeetState.FeetCrossingAmount = GetCurveValueClamped01(UAlsConstants::FeetCrossingCurveName());
+	FAlsFootUpdateContext LeftContext;
+	FAlsFootUpdateContext RightContext;
 
-	const auto ComponentTransform{GetProxyOnAnyThread<FAnimInstanceProxy>().GetComponentTransform()};
-
-	FAlsFootUpdateContext Context{
-		.ComponentTransform{ComponentTransform},
-		.ComponentTransformInverse{ComponentTransform.Inverse()},
-		.DeltaTime = DeltaTime
-	};
+	PrepareFeetUpdate(GetProxyOnAnyThread<FAnimInstanceProxy>().GetComponentTransform(), DeltaTime, LeftContext, RightContext);
 
-	Context.FootState = &FeetState.Left;
-	Context.IkAmount = GetCurveValueClamped01(UAlsConstants::FootLeftIkCurveName());
-	Context.LockAmount = GetCurveValueClamped01(UAlsConstants::FootLeftLockCurveName());
-
-	ProcessFootLockTeleport(Context);
-	ProcessFootLockBaseChange(Context);
-	RefreshFootLock(Context);
-
-	Context.FootState = &FeetState.Right;
-	Context.IkAmount = GetCurveValueClamped01(UAlsConstants::FootRightIkCurveName());
-	Context.LockAmount = GetCurveValueClamped01(UAlsConstants::FootRightLockCurveName());
-
-	ProcessFootLockTeleport(Context);
-	ProcessFootLockBaseChange(Context);
-	RefreshFootLock(Context);
+	SolveFootLock(FeetState.Left, LeftContext);
+	SolveFootLock(FeetState.Right, RightContext);
 }
 
-void UAlsAnimationInstance::ProcessFootLockTeleport(const FAlsFootUpdateContext& Context) const
+void UAlsAnimationInstance::PrepareFeetUpdate(const FTransform& ComponentTransform, const float DeltaTime,
+                                              FAlsFootUpdateContext& LeftContext, FAlsFootUpdateContext& RightContext)
 {
-	auto& FootState{*Context.FootState};
+	FeetState.FootPlantedAmount = FMath::Clamp(CurveCache.GetValue(EAlsAnimationCurve::FootPlanted), -1.0f, 1.0f);
+	FeetState.FeetCrossingAmount = CurveCache.GetValueClamped01(EAlsAnimationCurve::FeetCrossing);
+
+	LeftContext.ComponentTransform = ComponentTransform;
+	LeftContext.ComponentTransformInverse = ComponentTransform.Inverse();
+	LeftContext.MovementBaseLocation = MovementBase.Location;
+	LeftContext.MovementBaseRotation = MovementBase.Rotation;
+	LeftContext.PelvisRotation = FeetState.PelvisRotation;
+	LeftContext.DeltaTime = DeltaTime;
+	LeftContext.ThighAngleLimit = Settings->FootLock.ThighAngleLimit;
+	LeftContext.FootAngleLimit = Settings->FootLock.FootAngleLimit;
+	LeftContext.bAllowFootLock = Settings->FootLock.bAllowFootLock;
+	LeftContext.bFeetBecameValid = FeetState.bBecameValid;
 
 	// Due to network smoothing, we assume that teleportation occurs over a short period of time, not
 	// in one frame, since after accepting the teleportation event, the character can still be moved for
 	// some indefinite time, and this must be taken into account in order to avoid foot lock glitches.
 
-	if (FeetState.bBecameValid || GetWorld()->TimeSince(TeleportedTime) > 0.2f ||
-	    !FAnimWeight::IsRelevant(Context.IkAmount * FootState.LockAmount))
+	LeftContext.bTeleported = GetWorld()->TimeSince(TeleportedTime) <= 0.2f;
+	LeftContext.bMovementBaseChanged = MovementBase.bBaseChanged;
+	LeftContext.bMovementBaseHasRelativeLocation = MovementBase.bHasRelativeLocation;
+	LeftContext.bMovingSmooth = LocomotionState.bMovingSmooth;
+	LeftContext.bGrounded = LocomotionMode == AlsLocomotionModeTags::Grounded;
+
+	RightContext = LeftContext;
+
+	LeftContext.IkAmount = CurveCache.GetValueClamped01(EAlsAnimationCurve::FootLeftIk);
+	LeftContext.LockAmount = CurveCache.GetValueClamped01(EAlsAnimationCurve::FootLeftLock);
+
+	RightContext.IkAmount = CurveCache.GetValueClamped01(EAlsAnimationCurve::FootRightIk);
+	RightContext.LockAmount = CurveCache.GetValueClamped01(EAlsAnimationCurve::FootRightLock);
+}
+
+void UAlsAnimationInstance::SolveFootLock(FAlsFootState& FootState, const FAlsFootUpdateContext& Context)
+{
+	ProcessFootLockTeleport(FootState, Context);
+	ProcessFootLockBaseChange(FootState, Context);
+	RefreshFootLock(FootState, Context);
+}
+
+void UAlsAnimationInstance::ProcessFootLockTeleport(FAlsFootState& FootState, const FAlsFootUpdateContext& Context)
+{
+	if (Context.bFeetBecameValid || !Context.bTeleported || !FAnimWeight::IsRelevant(Context.IkAmount * FootState.LockAmount))
 	{
 		return;
 	}
@@ -1346,39 +1852,37 @@ void UAlsAnimationInstance::ProcessFootLockTeleport(const FAlsFootUpdateContext&
 	FootState.LockLocationWorldSpace = Context.ComponentTransform.TransformPosition(FVector{FootState.LockLocation});
 	FootState.LockRotationWorldSpace = Context.ComponentTransform.TransformRotation(FQuat{FootState.LockRotation});
 
-	if (MovementBase.bHasRelativeLocation)
+	if (Context.bMovementBaseHasRelativeLocation)
 	{
-		const auto BaseRotationInverse{MovementBase.Rotation.Inverse()};
+		const auto BaseRotationInverse{Context.MovementBaseRotation.Inverse()};
 
 		FootState.LockLocationMovementBaseSpace =
-			FVector3f{BaseRotationInverse.RotateVector(FootState.LockLocationWorldSpace - MovementBase.Location)};
+			FVector3f{BaseRotationInverse.RotateVector(FootState.LockLocationWorldSpace - Context.MovementBaseLocation)};
 
 		FootState.LockRotationMovementBaseSpace = FQuat4f{BaseRotationInverse * FootState.LockRotationWorldSpace};
 	}
 }
 
-void UAlsAnimationInstance::ProcessFootLockBaseChange(const FAlsFootUpdateContext& Context) const
+void UAlsAnimationInstance::ProcessFootLockBaseChange(FAlsFootState& FootState, const FAlsFootUpdateContext& Context)
 {
-	auto& FootState{*Context.FootState};
-
-	if ((!FeetState.bBecameValid && !MovementBase.bBaseChanged) ||
+	if ((!Context.bFeetBecameValid && !Context.bMovementBaseChanged) ||
 	    !FAnimWeight::IsRelevant(Context.IkAmount * FootState.LockAmount))
 	{
 		return;
 	}
 
-	if (FeetState.bBecameValid)
+	if (Context.bFeetBecameValid)
 	{
 		FootState.LockLocationWorldSpace = FootState.TargetLocationWorldSpace;
 		FootState.LockRotationWorldSpace = FootState.TargetRotationWorldSpace;
 	}
 
-	if (MovementBase.bHasRelativeLocation)
+	if (Context.bMovementBaseHasRelativeLocation)
 	{
-		const auto BaseRotationInverse{MovementBase.Rotation.Inverse()};
+		const auto BaseRotationInverse{Context.MovementBaseRotation.Inverse()};
 
 		FootState.LockLocationMovementBaseSpace =
-			FVector3f{BaseRotationInverse.RotateVector(FootState.LockLocationWorldSpace - MovementBase.Location)};
+			FVector3f{BaseRotationInverse.RotateVector(FootState.LockLocationWorldSpace - Context.MovementBaseLocation)};
 
 		FootState.LockRotationMovementBaseSpace = FQuat4f{BaseRotationInverse * FootState.LockRotationWorldSpace};
 	}
@@ -1392,12 +1896,11 @@ void UAlsAnimationInstance::ProcessFootLockBaseChange(const FAlsFootUpdateContex
 	FootState.LockRotation = FQuat4f{Context.ComponentTransformInverse.TransformRotation(FootState.LockRotationWorldSpace)};
 }
 
-void UAlsAnimationInstance::RefreshFootLock(const FAlsFootUpdateContext& Context) const
+void UAlsAnimationInstance::RefreshFootLock(FAlsFootState& FootState, const FAlsFootUpdateContext& Context)
 {
-	auto& FootState{*Context.FootState};
 	auto NewLockAmount{Context.LockAmount};
 
-	if (LocomotionState.bMovingSmooth || LocomotionMode != AlsLocomotionModeTags::Grounded)
+	if (Context.bMovingSmooth || !Context.bGrounded)
 	{
 		// Smoothly disable foot lock if the character is moving or in the air,
 		// instead of relying on the curve value from the animation blueprint.
@@ -1405,15 +1908,15 @@ void UAlsAnimationInstance::RefreshFootLock(const FAlsFootUpdateContext& Context
 		static constexpr auto MovingDecreaseSpeed{5.0f};
 		static constexpr auto NotGroundedDecreaseSpeed{0.6f};
 
-		NewLockAmount = FeetState.bBecameValid
+		NewLockAmount = Context.bFeetBecameValid
 			                ? 0.0f
 			                : FMath::Max(0.0f, FMath::Min(
 				                             NewLockAmount,
 				                             FootState.LockAmount - Context.DeltaTime *
-				                             (LocomotionState.bMovingSmooth ? MovingDecreaseSpeed : NotGroundedDecreaseSpeed)));
+				                             (Context.bMovingSmooth ? MovingDecreaseSpeed : NotGroundedDecreaseSpeed)));
 	}
 
-	if (!Settings->FootLock.bAllowFootLock || !FAnimWeight::IsRelevant(Context.IkAmount * NewLockAmount))
+	if (!Context.bAllowFootLock || !FAnimWeight::IsRelevant(Context.IkAmount * NewLockAmount))
 	{
 		if (FootState.LockAmount > 0.0f)
 		{
@@ -1449,7 +1952,7 @@ void UAlsAnimationInstance::RefreshFootLock(const FAlsFootUpdateContext& Context
 			FVector TargetLocation;
 			FQuat TargetRotation;
 
-			if (FeetState.bBecameValid)
+			if (Context.bFeetBecameValid)
 			{
 				TargetLocation = FootState.TargetLocationWorldSpace;
 				TargetRotation = FootState.TargetRotationWorldSpace;
@@ -1463,12 +1966,12 @@ void UAlsAnimationInstance::RefreshFootLock(const FAlsFootUpdateContext& Context
 				TargetRotation = Context.ComponentTransform.TransformRotation(FQuat{FootState.FinalRotation});
 			}
 
-			if (MovementBase.bHasRelativeLocation)
+			if (Context.bMovementBaseHasRelativeLocation)
 			{
-				const auto BaseRotationInverse{MovementBase.Rotation.Inverse()};
+				const auto BaseRotationInverse{Context.MovementBaseRotation.Inverse()};
 
 				FootState.LockLocationMovementBaseSpace =
-					FVector3f{BaseRotationInverse.RotateVector(TargetLocation - MovementBase.Location)};
+					FVector3f{BaseRotationInverse.RotateVector(TargetLocation - Context.MovementBaseLocation)};
 
 				FootState.LockRotationMovementBaseSpace = FQuat4f{BaseRotationInverse * TargetRotation};
 			}
@@ -1501,18 +2004,18 @@ void UAlsAnimationInstance::RefreshFootLock(const FAlsFootUpdateContext& Context
 		FootState.LockAmount = NewLockAmount;
 	}
 
-	if (MovementBase.bHasRelativeLocation)
+	if (Context.bMovementBaseHasRelativeLocation)
 	{
-		FootState.LockLocationWorldSpace = MovementBase.Location +
-		                                   MovementBase.Rotation.RotateVector(FVector{FootState.LockLocationMovementBaseSpace});
+		FootState.LockLocationWorldSpace = Context.MovementBaseLocation +
+		                                   Context.MovementBaseRotation.RotateVector(FVector{FootState.LockLocationMovementBaseSpace});
 
-		FootState.LockRotationWorldSpace = MovementBase.Rotation * FQuat{FootState.LockRotationMovementBaseSpace};
+		FootState.LockRotationWorldSpace = Context.MovementBaseRotation * FQuat{FootState.LockRotationMovementBaseSpace};
 	}
 
 	FootState.LockLocation = FVector3f{Context.ComponentTransformInverse.TransformPosition(FootState.LockLocationWorldSpace)};
 	FootState.LockRotation = FQuat4f{Context.ComponentTransformInverse.TransformRotation(FootState.LockRotationWorldSpace)};
 
-	ConstrainFootLock(FootState);
+	ConstrainFootLock(FootState, Context);
 
 	const auto FinalLocation{FMath::Lerp(FootState.TargetLocationWorldSpace, FootState.LockLocationWorldSpace, FootState.LockAmount)};
 
@@ -1523,33 +2026,31 @@ void UAlsAnimationInstance::RefreshFootLock(const FAlsFootUpdateContext& Context
 	FootState.FinalRotation = FQuat4f{Context.ComponentTransformInverse.TransformRotation(FinalRotation)};
 }
 
-void UAlsAnimationInstance::ConstrainFootLock(FAlsFootState& FootState) const
+void UAlsAnimationInstance::ConstrainFootLock(FAlsFootState& FootState, const FAlsFootUpdateContext& Context)
 {
 	// Limit the location of the locked foot to prevent legs from twisting into a spiral when the character rotates quickly.
 
-	const auto ThighAxis{FeetState.PelvisRotation.RotateVector(FootState.ThighAxisPelvisSpace)};
+	const auto ThighAxis{Context.PelvisRotation.RotateVector(FootState.ThighAxisPelvisSpace)};
 	const auto ThighDeltaAngle{UAlsVector::AngleBetweenSignedXY(ThighAxis, FootState.LockLocation)};
 
-	if (FMath::Abs(ThighDeltaAngle) > Settings->FootLock.ThighAngleLimit + UE_KINDA_SMALL_NUMBER)
+	if (FMath::Abs(ThighDeltaAngle) > Context.ThighAngleLimit + UE_KINDA_SMALL_NUMBER)
 	{
-		const auto ClampedAngle{FMath::Clamp(ThighDeltaAngle, -Settings->FootLock.ThighAngleLimit, Settings->FootLock.ThighAngleLimit)};
+		const auto ClampedAngle{FMath::Clamp(ThighDeltaAngle, -Context.ThighAngleLimit, Context.ThighAngleLimit)};
 		const FQuat4f OffsetRotation{FVector3f::UpVector, FMath::DegreesToRadians(ClampedAngle - ThighDeltaAngle)};
 
 		FootState.LockLocation = OffsetRotation.RotateVector(FootState.LockLocation);
 		FootState.LockRotation = OffsetRotation * FootState.LockRotation;
 		FootState.LockRotation.Normalize();
 
-		const auto& ComponentTransform{GetProxyOnAnyThread<FAnimInstanceProxy>().GetComponentTransform()};
+		FootState.LockLocationWorldSpace = Context.ComponentTransform.TransformPosition(FVector{FootState.LockLocation});
+		FootState.LockRotationWorldSpace = Context.ComponentTransform.TransformRotation(FQuat{FootState.LockRotation});
 
-		FootState.LockLocationWorldSpace = ComponentTransform.TransformPosition(FVector{FootState.LockLocation});
-		FootState.LockRotationWorldSpace = ComponentTransform.TransformRotation(FQuat{FootState.LockRotation});
-
-		if (MovementBase.bHasRelativeLocation)
+		if (Context.bMovementBaseHasRelativeLocation)
 		{
-			const auto BaseRotationInverse{MovementBase.Rotation.Inverse()};
+			const auto BaseRotationInverse{Context.MovementBaseRotation.Inverse()};
 
 			FootState.LockLocationMovementBaseSpace =
-				FVector3f{BaseRotationInverse.RotateVector(FootState.LockLocationWorldSpace - MovementBase.Location)};
+				FVector3f{BaseRotationInverse.RotateVector(FootState.LockLocationWorldSpace - Context.MovementBaseLocation)};
 
 			FootState.LockRotationMovementBaseSpace = FQuat4f{BaseRotationInverse * FootState.LockRotationWorldSpace};
 		}
@@ -1563,9 +2064,9 @@ void UAlsAnimationInstance::ConstrainFootLock(FAlsFootState& FootState) const
 			.GetTwistAngle(FVector3f::UpVector))
 	};
 
-	if (FMath::Abs(FootDeltaAngle) > Settings->FootLock.FootAngleLimit + UE_KINDA_SMALL_NUMBER)
+	if (FMath::Abs(FootDeltaAngle) > Context.FootAngleLimit + UE_KINDA_SMALL_NUMBER)
 	{
-		const auto ClampedAngle{FMath::Clamp(FootDeltaAngle, -Settings->FootLock.FootAngleLimit, Settings->FootLock.FootAngleLimit)};
+		const auto ClampedAngle{FMath::Clamp(FootDeltaAngle, -Context.FootAngleLimit, Context.FootAngleLimit)};
 		const FQuat4f OffsetRotation{FVector3f::UpVector, FMath::DegreesToRadians(ClampedAngle - FootDeltaAngle)};
 
 		FootState.LockRotationWorldSpace = FQuat{OffsetRotation} * FootState.LockRotationWorldSpace;
@@ -1674,9 +2175,13 @@ void UAlsAnimationInstance::StopTransitionAndTurnInPlaceAnimations(const float B
 
 void UAlsAnimationInstance::RefreshTransitions()
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsAnimationInstance::RefreshTransitions"),
+	                            STAT_UAlsAnimationInstance_RefreshTransitions, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	// The allow transitions curve is modified within certain states, so that transitions allowed will be true while in those states.
 
-	TransitionsState.bTransitionsAllowed = FAnimWeight::IsFullWeight(GetCurveValue(UAlsConstants::AllowTransitionsCurveName()));
+	TransitionsState.bTransitionsAllowed = FAnimWeight::IsFullWeight(CurveCache.GetValue(EAlsAnimationCurve::AllowTransitions));
 }
 
 void UAlsAnimationInstance::RefreshDynamicTransitions()
@@ -1699,6 +2204,11 @@ void UAlsAnimationInstance::RefreshDynamicTransitions()
 
 	DynamicTransitionsState.bUpdatedThisFrame = true;
 
+	if (GetAnimationLodLevel().bDisableDynamicTransitions)
+	{
+		return;
+	}
+
 	if (DynamicTransitionsState.FrameDelay > 0)
 	{
 		DynamicTransitionsState.FrameDelay -= 1;
@@ -1786,6 +2296,7 @@ void UAlsAnimationInstance::PlayQueuedTransitionAnimation()
 		return;
 	}
 
+	ALS_INC_COUNTER(MontagesPlayed);
 	PlaySlotAnimationAsDynamicMontage(TransitionsState.QueuedTransitionSequence, UAlsConstants::TransitionSlotName(),
 	                                  TransitionsState.QueuedTransitionBlendInDuration, TransitionsState.QueuedTransitionBlendOutDuration,
 	                                  TransitionsState.QueuedTransitionPlayRate, 1, 0.0f, TransitionsState.QueuedTransitionStartTime);
@@ -1844,7 +2355,7 @@ void UAlsAnimationInstance::RefreshRotateInPlace()
 
 	RotateInPlaceState.bUpdatedThisFrame = true;
 
-	if (LocomotionState.bMoving || !IsRotateInPlaceAllowed())
+	if (LocomotionState.bMoving || !IsRotateInPlaceAllowed() || GetAnimationLodLevel().bDisableRotateInPlace)
 	{
 		RotateInPlaceState.bRotatingLeft = false;
 		RotateInPlaceState.bRotatingRight = false;
@@ -1920,7 +2431,7 @@ void UAlsAnimationInstance::RefreshTurnInPlace()
 
 	TurnInPlaceState.bUpdatedThisFrame = true;
 
-	if (!TransitionsState.bTransitionsAllowed || !IsTurnInPlaceAllowed())
+	if (!TransitionsState.bTransitionsAllowed || !IsTurnInPlaceAllowed() || GetAnimationLodLevel().bDisableTurnInPlace)
 	{
 		TurnInPlaceState.ActivationDelay = 0.0f;
 		return;
@@ -2028,6 +2539,7 @@ void UAlsAnimationInstance::PlayQueuedTurnInPlaceAnimation()
 	FMontageBlendSettings BlendOutSettings{Settings->TurnInPlace.BlendDuration};
 	BlendOutSettings.BlendMode = EMontageBlendMode::Inertialization;
 
+	ALS_INC_COUNTER(MontagesPlayed);
 	PlaySlotAnimationAsDynamicMontage_WithBlendSettings(TurnInPlaceSettings->Sequence, TurnInPlaceState.QueuedSlotName,
 	                                                    BlendInSettings, BlendOutSettings, TurnInPlaceSettings->PlayRate, 1, 0.0f);
 
@@ -2047,6 +2559,10 @@ void UAlsAnimationInstance::PlayQueuedTurnInPlaceAnimation()
 
 void UAlsAnimationInstance::RefreshRagdollingOnGameThread()
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsAnimationInstance::RefreshRagdollingOnGameThread"),
+	                            STAT_UAlsAnimationInstance_RefreshRagdollingOnGameThread, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	check(IsInGameThread())
 
 	if (LocomotionAction != AlsLocomotionActionTags::Ragdolling)
@@ -2,6 +2,8 @@
 
 #include "AlsAnimationInstance.h"
 #include "AlsCharacterMovementComponent.h"
+#include "AlsSignificanceSubsystem.h"
+#include "AlsStateBatchSubsystem.h"
 #include "TimerManager.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/SkeletalMeshComponent.h"
@@ -14,11 +16,18 @@
 #include "Utility/AlsConstants.h"
 #include "Utility/AlsMacros.h"
 #include "Utility/AlsRotation.h"
+#include "Utility/AlsStats.h"
 #include "Utility/AlsUtility.h"
 #include "Utility/AlsVector.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsCharacter)
 
+namespace AlsCharacter
+{
+	// Minimum horizontal speed at which the character is considered to be moving.
+	static constexpr auto HasSpeedThreshold{1.0f};
+}
+
 AAlsCharacter::AAlsCharacter(const FObjectInitializer& ObjectInitializer) : Super{
 	ObjectInitializer.SetDefaultSubobjectClass<UAlsCharacterMovementComponent>(CharacterMovementComponentName)
 }
@@ -83,7 +92,7 @@ void AAlsCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLif
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, ViewMode, Parameters)
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, OverlayMode, Parameters)
 
-	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, ReplicatedViewRotation, Parameters)
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, NetViewRotation, Parameters)
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, InputDirection, Parameters)
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, DesiredVelocityYawAngle, Parameters)
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, RagdollTargetLocation, Parameters)
@@ -178,6 +187,38 @@ void AAlsCharacter::BeginPlay()
 	AlsCharacterMovement->SetRotationMode(RotationMode);
 
 	OnOverlayModeChanged(OverlayMode);
+
+	auto* SignificanceSubsystem{GetWorld()->GetSubsystem<UAlsSignificanceSubsystem>()};
+	if (IsValid(SignificanceSubsystem))
+	{
+		SignificanceSubsystem->RegisterCharacter(this);
+	}
+
+	if (IsValid(Settings) && Settings->bAllowBatchedStateUpdate)
+	{
+		auto* StateBatchSubsystem{GetWorld()->GetSubsystem<UAlsStateBatchSubsystem>()};
+		if (IsValid(StateBatchSubsystem))
+		{
+			StateBatchSubsystem->RegisterCharacter(this);
+		}
+	}
+}
+
+void AAlsCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	auto* SignificanceSubsystem{GetWorld()->GetSubsystem<UAlsSignificanceSubsystem>()};
+	if (IsValid(SignificanceSubsystem))
+	{
+		SignificanceSubsystem->UnregisterCharacter(this);
+	}
+
+	auto* StateBatchSubsystem{GetWorld()->GetSubsystem<UAlsStateBatchSubsystem>()};
+	if (IsValid(StateBatchSubsystem))
+	{
+		StateBatchSubsystem->UnregisterCharacter(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void AAlsCharacter::CalcCamera(const float DeltaTime, FMinimalViewInfo& ViewInfo)
@@ -267,6 +308,7 @@ void AAlsCharacter::Tick(const float DeltaTime)
 {
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AAlsCharacter::Tick"), STAT_AAlsCharacter_Tick, STATGROUP_Als)
 	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+	CSV_SCOPED_TIMING_STAT(Als, CharacterTick);
 
 	if (!IsValid(Settings) || !AnimationInstance.IsValid())
 	{
@@ -274,6 +316,43 @@ void AAlsCharacter::Tick(const float DeltaTime)
 		return;
 	}
 
+	FScopeCycleCounter TierTickCycleCounter{UAlsSignificanceSubsystem::GetTierTickStatId(SignificanceState.Tier)};
+
+	// Skip the refresh if the character has already been refreshed this frame by the state batch subsystem.
+
+	if (StateBatchRefreshFrame != GFrameCounter)
+	{
+		// Characters in lower significance tiers skip the refresh on some frames. The time skipped
+		// is accumulated and passed to the next refresh so that interpolations can catch up.
+
+		float RefreshDeltaTime;
+		if (ConsumeSignificanceRefresh(DeltaTime, RefreshDeltaTime))
+		{
+			RefreshBeforeStateUpdate(RefreshDeltaTime);
+
+			const auto bHadVelocity{LocomotionState.bHasVelocity};
+
+			RefreshViewState(ViewState, MovementBase, ReplicatedViewRotation, IsNetMode(NM_ListenServer), RefreshDeltaTime);
+			RefreshLocomotionVelocity(LocomotionState, GetVelocity());
+
+			RefreshAfterStateUpdate(RefreshDeltaTime, bHadVelocity);
+		}
+		else
+		{
+			RefreshThrottled();
+		}
+	}
+
+	Super::Tick(DeltaTime);
+
+	RefreshLocomotionLate();
+}
+
+void AAlsCharacter::RefreshBeforeStateUpdate(const float DeltaTime)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AAlsCharacter::RefreshBeforeStateUpdate"), STAT_AAlsCharacter_RefreshBeforeStateUpdate, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	RefreshMovementBase();
 
 	RefreshMeshProperties();
@@ -282,8 +361,15 @@ void AAlsCharacter::Tick(const float DeltaTime)
 
 	RefreshLocomotionEarly();
 
-	RefreshView(DeltaTime);
-	RefreshLocomotion();
+	RefreshReplicatedViewRotation();
+}
+
+void AAlsCharacter::RefreshAfterStateUpdate(const float DeltaTime, const bool bHadVelocity)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AAlsCharacter::RefreshAfterStateUpdate"), STAT_AAlsCharacter_RefreshAfterStateUpdate, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
+	RefreshLocomotion(bHadVelocity);
 	RefreshGait();
 	RefreshRotationMode();
 
@@ -293,10 +379,19 @@ void AAlsCharacter::Tick(const float DeltaTime)
 	RefreshMantling();
 	RefreshRagdolling(DeltaTime);
 	RefreshRolling(DeltaTime);
+}
 
-	Super::Tick(DeltaTime);
+void AAlsCharacter::RefreshThrottled()
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AAlsCharacter::RefreshThrottled"), STAT_AAlsCharacter_RefreshThrottled, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
 
-	RefreshLocomotionLate();
+	// The movement base changes will be accumulated and detected during the next refresh.
+
+	MovementBase.bBaseChanged = false;
+	MovementBase.DeltaRotation = FRotator::ZeroRotator;
+
+	RefreshMeshProperties();
 }
 
 void AAlsCharacter::PossessedBy(AController* NewController)
@@ -311,6 +406,17 @@ void AAlsCharacter::PossessedBy(AController* NewController)
 		IsNetMode(NM_ListenServer) && GetRemoteRole() == ROLE_AutonomousProxy;
 }
 
+void AAlsCharacter::NotifyControllerChanged()
+{
+	Super::NotifyControllerChanged();
+
+	auto* StateBatchSubsystem{GetWorld()->GetSubsystem<UAlsStateBatchSubsystem>()};
+	if (IsValid(StateBatchSubsystem))
+	{
+		StateBatchSubsystem->RefreshControllerTickPrerequisite(this, PreviousController);
+	}
+}
+
 void AAlsCharacter::Restart()
 {
 	Super::Restart();
@@ -325,6 +431,9 @@ bool AAlsCharacter::OnCalculateCamera_Implementation(float DeltaTime, FMinimalVi
 
 void AAlsCharacter::RefreshMeshProperties() const
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AAlsCharacter::RefreshMeshProperties"), STAT_AAlsCharacter_RefreshMeshProperties, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	const auto bStandalone{IsNetMode(NM_Standalone)};
 	const auto bDedicatedServer{IsNetMode(NM_DedicatedServer)};
 	const auto bListenServer{IsNetMode(NM_ListenServer)};
@@ -402,6 +511,9 @@ void AAlsCharacter::RefreshMeshProperties() const
 
 void AAlsCharacter::RefreshMovementBase()
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AAlsCharacter::RefreshMovementBase"), STAT_AAlsCharacter_RefreshMovementBase, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	if (BasedMovement.MovementBaseInterfaceData != MovementBase.MovementBaseInterfaceData ||
 	    BasedMovement.BoneName != MovementBase.BoneName)
 	{
@@ -427,6 +539,51 @@ void AAlsCharacter::RefreshMovementBase()
 		                             : FRotator::ZeroRotator;
 }
 
+void AAlsCharacter::SetSignificance(const EAlsSignificanceTier NewTier, const float NewViewerDistance)
+{
+	SignificanceState.ViewerDistance = NewViewerDistance;
+
+	if (SignificanceState.Tier == NewTier)
+	{
+		return;
+	}
+
+	const auto PreviousTier{SignificanceState.Tier};
+
+	SignificanceState.Tier = NewTier;
+
+	const auto RefreshInterval{IsValid(Settings) ? Settings->Significance.GetRefreshInterval(NewTier) : 0.0f};
+
+	// Don't make the character wait longer than the new refresh interval when moving to a higher tier. When moving
+	// to a lower tier, randomize the delay so that characters that changed tiers together don't refresh in the same frame.
+
+	SignificanceState.RefreshDelay = NewTier < PreviousTier
+		                                 ? FMath::Min(SignificanceState.RefreshDelay, RefreshInterval)
+		                                 : FMath::FRand() * RefreshInterval;
+}
+
+bool AAlsCharacter::ConsumeSignificanceRefresh(const float DeltaTime, float& RefreshDeltaTime)
+{
+	SignificanceState.AccumulatedDeltaTime += DeltaTime;
+	SignificanceState.RefreshDelay -= DeltaTime;
+
+	if (SignificanceState.RefreshDelay > 0.0f)
+	{
+		RefreshDeltaTime = 0.0f;
+		return false;
+	}
+
+	// Carry over the overshoot to keep the average refresh rate, but don't let it pile up after long frames.
+
+	SignificanceState.RefreshDelay = FMath::Max(0.0f, SignificanceState.RefreshDelay +
+	                                                  Settings->Significance.GetRefreshInterval(SignificanceState.Tier));
+
+	RefreshDeltaTime = SignificanceState.AccumulatedDeltaTime;
+	SignificanceState.AccumulatedDeltaTime = 0.0f;
+
+	return true;
+}
+
 void AAlsCharacter::SetViewMode(const FGameplayTag NewViewMode)
 {
 	SetViewMode(NewViewMode, true);
@@ -447,10 +604,12 @@ void AAlsCharacter::SetViewMode(const FGameplayTag NewViewMode, const bool bSend
 	{
 		if (GetLocalRole() >= ROLE_Authority)
 		{
+			ALS_INC_COUNTER(RpcsSent);
 			ClientSetViewMode(ViewMode);
 		}
 		else
 		{
+			ALS_INC_COUNTER(RpcsSent);
 			ServerSetViewMode(ViewMode);
 		}
 	}
@@ -583,10 +742,12 @@ void AAlsCharacter::SetDesiredAiming(const bool bNewDesiredAiming, const bool bS
 	{
 		if (GetLocalRole() >= ROLE_Authority)
 		{
+			ALS_INC_COUNTER(RpcsSent);
 			ClientSetDesiredAiming(bDesiredAiming);
 		}
 		else
 		{
+			ALS_INC_COUNTER(RpcsSent);
 			ServerSetDesiredAiming(bDesiredAiming);
 		}
 	}
@@ -629,10 +790,12 @@ void AAlsCharacter::SetDesiredRotationMode(const FGameplayTag NewDesiredRotation
 	{
 		if (GetLocalRole() >= ROLE_Authority)
 		{
+			ALS_INC_COUNTER(RpcsSent);
 			ClientSetDesiredRotationMode(DesiredRotationMode);
 		}
 		else
 		{
+			ALS_INC_COUNTER(RpcsSent);
 			ServerSetDesiredRotationMode(DesiredRotationMode);
 		}
 	}
@@ -674,6 +837,9 @@ void AAlsCharacter::NotifyRotationModeChanged(const FGameplayTag PreviousRotatio
 
 void AAlsCharacter::RefreshRotationMode()
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AAlsCharacter::RefreshRotationMode"), STAT_AAlsCharacter_RefreshRotationMode, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	const auto bAiming{bDesiredAiming || DesiredRotationMode == AlsRotationModeTags::Aiming};
 	const auto bSprinting{AlsCharacterMovement->GetMaxAllowedGait() == AlsGaitTags::Sprinting};
 
@@ -777,10 +943,12 @@ void AAlsCharacter::SetDesiredStance(const FGameplayTag NewDesiredStance, const
 	{
 		if (GetLocalRole() >= ROLE_Authority)
 		{
+			ALS_INC_COUNTER(RpcsSent);
 			ClientSetDesiredStance(DesiredStance);
 		}
 		else
 		{
+			ALS_INC_COUNTER(RpcsSent);
 			ServerSetDesiredStance(DesiredStance);
 		}
 	}
@@ -906,10 +1074,12 @@ void AAlsCharacter::SetDesiredGait(const FGameplayTag NewDesiredGait, const bool
 	{
 		if (GetLocalRole() >= ROLE_Authority)
 		{
+			ALS_INC_COUNTER(RpcsSent);
 			ClientSetDesiredGait(DesiredGait);
 		}
 		else
 		{
+			ALS_INC_COUNTER(RpcsSent);
 			ServerSetDesiredGait(DesiredGait);
 		}
 	}
@@ -941,6 +1111,9 @@ void AAlsCharacter::OnGaitChanged_Implementation(const FGameplayTag PreviousGait
 
 void AAlsCharacter::RefreshGait()
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AAlsCharacter::RefreshGait"), STAT_AAlsCharacter_RefreshGait, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	if (LocomotionMode != AlsLocomotionModeTags::Grounded)
 	{
 		return;
@@ -1050,10 +1223,12 @@ void AAlsCharacter::SetOverlayMode(const FGameplayTag NewOverlayMode, const bool
 	{
 		if (GetLocalRole() >= ROLE_Authority)
 		{
+			ALS_INC_COUNTER(RpcsSent);
 			ClientSetOverlayMode(OverlayMode);
 		}
 		else
 		{
+			ALS_INC_COUNTER(RpcsSent);
 			ServerSetOverlayMode(OverlayMode);
 		}
 	}
@@ -1114,6 +1289,9 @@ void AAlsCharacter::SetInputDirection(FVector NewInputDirection)
 
 void AAlsCharacter::RefreshInput(const float DeltaTime)
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AAlsCharacter::RefreshInput"), STAT_AAlsCharacter_RefreshInput, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	if (GetLocalRole() >= ROLE_AutonomousProxy)
 	{
 		SetInputDirection(GetCharacterMovement()->GetCurrentAcceleration() / GetCharacterMovement()->GetMaxAcceleration());
@@ -1129,31 +1307,32 @@ void AAlsCharacter::RefreshInput(const float DeltaTime)
 
 void AAlsCharacter::SetReplicatedViewRotation(const FRotator& NewViewRotation, const bool bSendRpc)
 {
-	if (!ReplicatedViewRotation.Equals(NewViewRotation))
-	{
-		ReplicatedViewRotation = NewViewRotation;
+	ReplicatedViewRotation = NewViewRotation;
 
-		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, ReplicatedViewRotation, this)
+	// The owning client doesn't know how far away other players are, so it always uses the base threshold,
+	// and the server applies its own distance-dependent threshold before replicating the rotation further.
 
-		if (bSendRpc && GetLocalRole() == ROLE_AutonomousProxy)
-		{
-			ServerSetReplicatedViewRotation(ReplicatedViewRotation);
-		}
+	if (bSendRpc && GetLocalRole() == ROLE_AutonomousProxy && IsValid(Settings) &&
+	    TryUpdateNetViewRotation(Settings->View.ReplicationAngleThreshold))
+	{
+		ALS_INC_COUNTER(RpcsSent);
+		ServerSetReplicatedViewRotation(NetViewRotation);
 	}
 }
 
-void AAlsCharacter::ServerSetReplicatedViewRotation_Implementation(FRotator NewViewRotation)
+void AAlsCharacter::ServerSetReplicatedViewRotation_Implementation(const FAlsNetViewRotation NewViewRotation)
 {
-	// FRotator replicates angles in the [0, 360) range, so we have to re-normalize them to the [-180, 180) range before use.
-	NewViewRotation.Normalize();
+	SetReplicatedViewRotation(NewViewRotation.Rotation, false);
+}
 
+void AAlsCharacter::SetReplicatedViewRotationFromMove(const FRotator& NewViewRotation)
+{
 	SetReplicatedViewRotation(NewViewRotation, false);
 }
 
-void AAlsCharacter::OnReplicated_ReplicatedViewRotation()
+void AAlsCharacter::OnReplicated_NetViewRotation()
 {
-	// FRotator replicates angles in the [0, 360) range, so we have to re-normalize them to the [-180, 180) range before use.
-	ReplicatedViewRotation.Normalize();
+	ReplicatedViewRotation = NetViewRotation.Rotation;
 
 	CorrectViewNetworkSmoothing(MovementBase.bHasRelativeRotation
 		                            ? (MovementBase.Rotation * ReplicatedViewRotation.Quaternion()).Rotator()
@@ -1219,27 +1398,22 @@ void AAlsCharacter::CorrectViewNetworkSmoothing(const FRotator& TargetRotation)
 	NetworkSmoothing.Duration = NetworkSmoothing.ServerTime - NetworkSmoothing.ClientTime;
 }
 
-void AAlsCharacter::RefreshView(const float DeltaTime)
+void AAlsCharacter::RefreshReplicatedViewRotation()
 {
-	if (MovementBase.bHasRelativeRotation)
-	{
-		// Offset the rotations to keep them in the movement base space.
-
-		ViewState.Rotation.Pitch += MovementBase.DeltaRotation.Pitch;
-		ViewState.Rotation.Yaw += MovementBase.DeltaRotation.Yaw;
-		ViewState.Rotation.Normalize();
-	}
-
-	ViewState.PreviousYawAngle = UE_REAL_TO_FLOAT(ViewState.Rotation.Yaw);
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AAlsCharacter::RefreshReplicatedViewRotation"),
+	                            STAT_AAlsCharacter_RefreshReplicatedViewRotation, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
 
 	if (MovementBase.bHasRelativeRotation)
 	{
 		if (IsLocallyControlled())
 		{
-			// We can't depend on the view rotation sent by the character movement component
-			// since it's in world space, so in this case we always send it ourselves.
+			// We can't depend on the control rotation sent by the character movement component since it's in world space,
+			// so in this case the view rotation is sent in movement base space as part of the move data, see
+			// FAlsCharacterNetworkMoveData. The separate RPC is only used if the character doesn't send any moves.
 
-			SetReplicatedViewRotation((MovementBase.Rotation.Inverse() * Super::GetViewRotation().Quaternion()).Rotator(), true);
+			SetReplicatedViewRotation((MovementBase.Rotation.Inverse() * Super::GetViewRotation().Quaternion()).Rotator(),
+			                          !IsReplicatingMovement());
 		}
 	}
 	else
@@ -1253,37 +1427,89 @@ void AAlsCharacter::RefreshView(const float DeltaTime)
 		}
 	}
 
-	RefreshViewNetworkSmoothing(DeltaTime);
+	if (GetLocalRole() >= ROLE_Authority && !IsNetMode(NM_Standalone) &&
+	    TryUpdateNetViewRotation(Settings->View.GetReplicationAngleThreshold(SignificanceState.ViewerDistance)))
+	{
+		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, NetViewRotation, this)
+	}
+}
 
-	ViewState.Rotation = ViewState.NetworkSmoothing.FinalRotation;
+bool AAlsCharacter::TryUpdateNetViewRotation(const float AngleThreshold)
+{
+	const auto NewRotation{FAlsNetViewRotation::Quantize(ReplicatedViewRotation)};
+	if (NewRotation == NetViewRotation.Rotation)
+	{
+		return false;
+	}
+
+	// Changes below the threshold are still sent once the replication interval has elapsed, so
+	// that the receivers don't get stuck with a slightly outdated rotation when the view stops.
+
+	const auto WorldTime{GetWorld()->GetTimeSeconds()};
+
+	if (NetViewRotation.Rotation.Equals(NewRotation, AngleThreshold) &&
+	    WorldTime - NetViewRotationTime < Settings->View.ReplicationInterval)
+	{
+		return false;
+	}
+
+	NetViewRotation.Rotation = NewRotation;
+	NetViewRotationTime = WorldTime;
+
+	return true;
+}
+
+void AAlsCharacter::RefreshViewState(FAlsViewState& State, const FAlsMovementBaseState& Base,
+                                     const FRotator& ReplicatedRotation, const bool bListenServer, const float DeltaTime)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AAlsCharacter::RefreshViewState"), STAT_AAlsCharacter_RefreshViewState, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
+	if (Base.bHasRelativeRotation)
+	{
+		// Offset the rotations to keep them in the movement base space.
+
+		State.Rotation.Pitch += Base.DeltaRotation.Pitch;
+		State.Rotation.Yaw += Base.DeltaRotation.Yaw;
+		State.Rotation.Normalize();
+	}
+
+	State.PreviousYawAngle = UE_REAL_TO_FLOAT(State.Rotation.Yaw);
+
+	RefreshViewNetworkSmoothing(State.NetworkSmoothing, Base, ReplicatedRotation, bListenServer, DeltaTime);
+
+	State.Rotation = State.NetworkSmoothing.FinalRotation;
 
 	// Set the yaw speed by comparing the current and previous view yaw angle, divided by
 	// delta seconds. This represents the speed the camera is rotating from left to right.
 
 	if (DeltaTime > UE_SMALL_NUMBER)
 	{
-		ViewState.YawSpeed = FMath::Abs(UE_REAL_TO_FLOAT(ViewState.Rotation.Yaw - ViewState.PreviousYawAngle)) / DeltaTime;
+		State.YawSpeed = FMath::Abs(UE_REAL_TO_FLOAT(State.Rotation.Yaw - State.PreviousYawAngle)) / DeltaTime;
 	}
 }
 
-void AAlsCharacter::RefreshViewNetworkSmoothing(const float DeltaTime)
+void AAlsCharacter::RefreshViewNetworkSmoothing(FAlsViewNetworkSmoothingState& NetworkSmoothing, const FAlsMovementBaseState& Base,
+                                                const FRotator& ReplicatedRotation, const bool bListenServer, const float DeltaTime)
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AAlsCharacter::RefreshViewNetworkSmoothing"),
+	                            STAT_AAlsCharacter_RefreshViewNetworkSmoothing, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	// Based on UCharacterMovementComponent::SmoothClientPosition_Interpolate()
 	// and UCharacterMovementComponent::SmoothClientPosition_UpdateVisuals().
 
-	auto& NetworkSmoothing{ViewState.NetworkSmoothing};
-
 	if (!NetworkSmoothing.bEnabled ||
 	    NetworkSmoothing.ClientTime >= NetworkSmoothing.ServerTime ||
 	    NetworkSmoothing.Duration <= UE_SMALL_NUMBER ||
-	    (MovementBase.bHasRelativeRotation && IsNetMode(NM_ListenServer)))
+	    (Base.bHasRelativeRotation && bListenServer))
 	{
 		// Can't use network smoothing on the listen server when the character
 		// is standing on a rotating object, as it causes constant rotation jitter.
 
-		NetworkSmoothing.InitialRotation = MovementBase.bHasRelativeRotation
-			                                   ? (MovementBase.Rotation * ReplicatedViewRotation.Quaternion()).Rotator()
-			                                   : ReplicatedViewRotation;
+		NetworkSmoothing.InitialRotation = Base.bHasRelativeRotation
+			                                   ? (Base.Rotation * ReplicatedRotation.Quaternion()).Rotator()
+			                                   : ReplicatedRotation;
 
 		NetworkSmoothing.TargetRotation = NetworkSmoothing.InitialRotation;
 		NetworkSmoothing.FinalRotation = NetworkSmoothing.InitialRotation;
@@ -1291,20 +1517,20 @@ void AAlsCharacter::RefreshViewNetworkSmoothing(const float DeltaTime)
 		return;
 	}
 
-	if (MovementBase.bHasRelativeRotation)
+	if (Base.bHasRelativeRotation)
 	{
 		// Offset the rotations to keep them in the movement base space.
 
-		NetworkSmoothing.InitialRotation.Pitch += MovementBase.DeltaRotation.Pitch;
-		NetworkSmoothing.InitialRotation.Yaw += MovementBase.DeltaRotation.Yaw;
+		NetworkSmoothing.InitialRotation.Pitch += Base.DeltaRotation.Pitch;
+		NetworkSmoothing.InitialRotation.Yaw += Base.DeltaRotation.Yaw;
 		NetworkSmoothing.InitialRotation.Normalize();
 
-		NetworkSmoothing.TargetRotation.Pitch += MovementBase.DeltaRotation.Pitch;
-		NetworkSmoothing.TargetRotation.Yaw += MovementBase.DeltaRotation.Yaw;
+		NetworkSmoothing.TargetRotation.Pitch += Base.DeltaRotation.Pitch;
+		NetworkSmoothing.TargetRotation.Yaw += Base.DeltaRotation.Yaw;
 		NetworkSmoothing.TargetRotation.Normalize();
 
-		NetworkSmoothing.FinalRotation.Pitch += MovementBase.DeltaRotation.Pitch;
-		NetworkSmoothing.FinalRotation.Yaw += MovementBase.DeltaRotation.Yaw;
+		NetworkSmoothing.FinalRotation.Pitch += Base.DeltaRotation.Pitch;
+		NetworkSmoothing.FinalRotation.Yaw += Base.DeltaRotation.Yaw;
 		NetworkSmoothing.FinalRotation.Normalize();
 	}
 
@@ -1334,6 +1560,9 @@ void AAlsCharacter::SetDesiredVelocityYawAngle(const float NewVelocityYawAngle)
 
 void AAlsCharacter::RefreshLocomotionEarly()
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AAlsCharacter::RefreshLocomotionEarly"), STAT_AAlsCharacter_RefreshLocomotionEarly, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	if (!LocomotionState.bMoving &&
 	    RotationMode == AlsRotationModeTags::VelocityDirection &&
 	    Settings->bInheritMovementBaseRotationInVelocityDirectionRotationMode)
@@ -1369,27 +1598,33 @@ void AAlsCharacter::RefreshLocomotionEarly()
 	LocomotionState.bAimingLimitAppliedThisFrame = false;
 }
 
-void AAlsCharacter::RefreshLocomotion()
+void AAlsCharacter::RefreshLocomotionVelocity(FAlsLocomotionState& State, const FVector& Velocity)
 {
-	const auto bHadVelocity{LocomotionState.bHasVelocity};
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AAlsCharacter::RefreshLocomotionVelocity"),
+	                            STAT_AAlsCharacter_RefreshLocomotionVelocity, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
 
-	LocomotionState.Velocity = GetVelocity();
+	State.Velocity = Velocity;
 
 	// Determine if the character is moving by getting its speed. The speed equals the length
 	// of the horizontal velocity, so it does not take vertical movement into account. If the
 	// character is moving, update the last velocity rotation. This value is saved because it might
 	// be useful to know the last orientation of a movement even after the character has stopped.
 
-	LocomotionState.Speed = UE_REAL_TO_FLOAT(LocomotionState.Velocity.Size2D());
+	State.Speed = UE_REAL_TO_FLOAT(State.Velocity.Size2D());
 
-	static constexpr auto HasSpeedThreshold{1.0f};
+	State.bHasVelocity = State.Speed >= AlsCharacter::HasSpeedThreshold;
 
-	LocomotionState.bHasVelocity = LocomotionState.Speed >= HasSpeedThreshold;
-
-	if (LocomotionState.bHasVelocity)
+	if (State.bHasVelocity)
 	{
-		LocomotionState.VelocityYawAngle = UE_REAL_TO_FLOAT(UAlsVector::DirectionToAngleXY(LocomotionState.Velocity));
+		State.VelocityYawAngle = UE_REAL_TO_FLOAT(UAlsVector::DirectionToAngleXY(State.Velocity));
 	}
+}
+
+void AAlsCharacter::RefreshLocomotion(const bool bHadVelocity)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AAlsCharacter::RefreshLocomotion"), STAT_AAlsCharacter_RefreshLocomotion, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
 
 	if (GetLocalRole() >= ROLE_AutonomousProxy)
 	{
@@ -1400,7 +1635,7 @@ void AAlsCharacter::RefreshLocomotion()
 		{
 			FVector DesiredVelocity;
 			if (AlsCharacterMovement->TryConsumePrePenetrationAdjustmentVelocity(DesiredVelocity) &&
-			    DesiredVelocity.Size2D() >= HasSpeedThreshold)
+			    DesiredVelocity.Size2D() >= AlsCharacter::HasSpeedThreshold)
 			{
 				bSendInitialVelocityYawAngle = !bHasDesiredVelocity;
 				bHasDesiredVelocity = true;
@@ -1426,6 +1661,7 @@ void AAlsCharacter::RefreshLocomotion()
 		     GetRemoteRole() == ROLE_SimulatedProxy ||
 		     (IsNetMode(NM_ListenServer) && IsLocallyControlled())))
 		{
+			ALS_INC_COUNTER(RpcsSent);
 			ServerSetInitialVelocityYawAngle(VelocityYawAngleToSend);
 		}
 	}
@@ -1438,6 +1674,9 @@ void AAlsCharacter::RefreshLocomotion()
 
 void AAlsCharacter::RefreshLocomotionLate()
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AAlsCharacter::RefreshLocomotionLate"), STAT_AAlsCharacter_RefreshLocomotionLate, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	if (!LocomotionMode.IsValid() || LocomotionAction.IsValid())
 	{
 		RefreshTargetYawAngleUsingActorRotation();
@@ -1448,6 +1687,7 @@ void AAlsCharacter::RefreshLocomotionLate()
 
 void AAlsCharacter::ServerSetInitialVelocityYawAngle_Implementation(const float NewVelocityYawAngle)
 {
+	ALS_INC_COUNTER(RpcsSent);
 	MulticastSetInitialVelocityYawAngle(NewVelocityYawAngle);
 }
 
@@ -1480,6 +1720,7 @@ void AAlsCharacter::OnJumped_Implementation()
 	}
 	else if (GetLocalRole() >= ROLE_Authority)
 	{
+		ALS_INC_COUNTER(RpcsSent);
 		MulticastOnJumpedNetworked();
 	}
 }
@@ -1513,6 +1754,9 @@ void AAlsCharacter::CharacterMovement_OnPhysicsRotation(const float DeltaTime)
 
 void AAlsCharacter::RefreshGroundedRotation(const float DeltaTime)
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AAlsCharacter::RefreshGroundedRotation"), STAT_AAlsCharacter_RefreshGroundedRotation, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	if (LocomotionAction.IsValid() || LocomotionMode != AlsLocomotionModeTags::Grounded)
 	{
 		return;
@@ -1663,6 +1907,9 @@ void AAlsCharacter::RefreshGroundedRotation(const float DeltaTime)
 
 void AAlsCharacter::RefreshRotation(const float DeltaTime)
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AAlsCharacter::RefreshRotation"), STAT_AAlsCharacter_RefreshRotation, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	RefreshGroundedRotation(DeltaTime);
 	RefreshInAirRotation(DeltaTime);
 }
@@ -1679,6 +1926,10 @@ bool AAlsCharacter::RefreshCustomGroundedNotMovingRotation(const float DeltaTime
 
 void AAlsCharacter::RefreshGroundedAimingRotation(const float DeltaTime)
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AAlsCharacter::RefreshGroundedAimingRotation"),
+	                            STAT_AAlsCharacter_RefreshGroundedAimingRotation, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	auto NewActorRotation{GetActorRotation()};
 
 	if (!LocomotionState.bHasInput && !LocomotionState.bMoving)
@@ -1792,13 +2043,14 @@ float AAlsCharacter::CalculateGroundedMovingRotationInterpolationHalfLife() cons
 	// the curve in conjunction with the gait amount gives you a high level of control over the rotation
 	// rates for each speed. Increase the speed if the camera is rotating quickly for more responsive rotation.
 
-	const auto* InterpolationSpeedCurve{AlsCharacterMovement->GetGaitSettings().RotationInterpolationSpeedCurve.Get()};
+	const auto& GaitSettings{AlsCharacterMovement->GetGaitSettings()};
 
 	static constexpr auto DefaultInterpolationHalfLife{0.2f};
 
 	const auto InterpolationHalfLife{
-		ALS_ENSURE(IsValid(InterpolationSpeedCurve))
-			? InterpolationSpeedCurve->GetFloatValue(FMath::Max(1.0f, AlsCharacterMovement->GetGaitAmount()))
+		ALS_ENSURE(IsValid(GaitSettings.RotationInterpolationSpeedCurve))
+			? GaitSettings.RotationInterpolationSpeedBakedCurve.Evaluate(FMath::Max(1.0f, AlsCharacterMovement->GetGaitAmount()),
+			                                                             GaitSettings.RotationInterpolationSpeedCurve)
 			: DefaultInterpolationHalfLife
 	};
 
@@ -1825,6 +2077,9 @@ void AAlsCharacter::ApplyRotationYawSpeedAnimationCurve(const float DeltaTime)
 
 void AAlsCharacter::RefreshInAirRotation(const float DeltaTime)
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AAlsCharacter::RefreshInAirRotation"), STAT_AAlsCharacter_RefreshInAirRotation, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	if (LocomotionAction.IsValid() || LocomotionMode != AlsLocomotionModeTags::InAir)
 	{
 		return;
@@ -1877,6 +2132,10 @@ bool AAlsCharacter::RefreshCustomInAirRotation(const float DeltaTime)
 
 void AAlsCharacter::RefreshInAirAimingRotation(const float DeltaTime)
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AAlsCharacter::RefreshInAirAimingRotation"),
+	                            STAT_AAlsCharacter_RefreshInAirAimingRotation, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	static constexpr auto RotationInterpolationHalfLife{0.1f};
 
 	SetTargetYawAngle(UE_REAL_TO_FLOAT(ViewState.Rotation.Yaw));
@@ -1925,6 +2184,10 @@ void AAlsCharacter::SetRotationInstant(const float TargetYawAngle, const ETelepo
 
 void AAlsCharacter::RefreshTargetYawAngleUsingActorRotation()
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AAlsCharacter::RefreshTargetYawAngleUsingActorRotation"),
+	                            STAT_AAlsCharacter_RefreshTargetYawAngleUsingActorRotation, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	const auto YawAngle{UE_REAL_TO_FLOAT(GetActorRotation().Yaw)};
 
 	SetTargetYawAngle(YawAngle);
@@ -1951,6 +2214,10 @@ void AAlsCharacter::SetTargetYawAngleSmooth(const float TargetYawAngle, const fl
 
 void AAlsCharacter::RefreshTargetYawAngleViewSpace()
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AAlsCharacter::RefreshTargetYawAngleViewSpace"),
+	                            STAT_AAlsCharacter_RefreshTargetYawAngleViewSpace, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	LocomotionState.TargetYawAngleViewSpace = FMath::UnwindDegrees(UE_REAL_TO_FLOAT(
 		ViewState.Rotation.Yaw - LocomotionState.TargetYawAngle));
 }
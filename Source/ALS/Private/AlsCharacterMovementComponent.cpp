@@ -8,11 +8,35 @@
 #include "GameFramework/Controller.h"
 #include "Utility/AlsMacros.h"
 #include "Utility/AlsRotation.h"
+#include "Utility/AlsStats.h"
 #include "Utility/AlsUtility.h"
 #include "Utility/AlsVector.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsCharacterMovementComponent)
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Floor Cache Hits"), STAT_Als_FloorCacheHits, STATGROUP_Als)
+
+namespace AlsCharacterMovementComponent
+{
+	// Tags are replicated by their indices in these arrays, so existing tags must never be reordered or removed.
+
+	static const FNativeGameplayTag* const KnownRotationModeTags[]{
+		&AlsRotationModeTags::VelocityDirection, &AlsRotationModeTags::ViewDirection, &AlsRotationModeTags::Aiming
+	};
+
+	static const FNativeGameplayTag* const KnownStanceTags[]{&AlsStanceTags::Standing, &AlsStanceTags::Crouching};
+
+	static const FNativeGameplayTag* const KnownGaitTags[]{&AlsGaitTags::Walking, &AlsGaitTags::Running, &AlsGaitTags::Sprinting};
+
+	static_assert(UE_ARRAY_COUNT(KnownRotationModeTags) < FAlsCharacterNetworkMoveData::UnknownTagIndex);
+	static_assert(UE_ARRAY_COUNT(KnownStanceTags) < FAlsCharacterNetworkMoveData::UnknownTagIndex);
+	static_assert(UE_ARRAY_COUNT(KnownGaitTags) < FAlsCharacterNetworkMoveData::UnknownTagIndex);
+
+	static constexpr auto FloorCacheLocationTolerance{0.01f};
+
+	static constexpr auto FloorCacheRotationTolerance{1.0e-5f};
+}
+
 void FAlsCharacterNetworkMoveData::ClientFillNetworkMoveData(const FSavedMove_Character& Move, const ENetworkMoveType MoveType)
 {
 	Super::ClientFillNetworkMoveData(Move, MoveType);
@@ -22,6 +46,11 @@ void FAlsCharacterNetworkMoveData::ClientFillNetworkMoveData(const FSavedMove_Ch
 	RotationMode = SavedMove.RotationMode;
 	Stance = SavedMove.Stance;
 	MaxAllowedGait = SavedMove.MaxAllowedGait;
+
+	// The server only needs the most recent view rotation, so it's not sent again with the pending and old moves.
+
+	bHasRelativeViewRotation = MoveType == ENetworkMoveType::NewMove && SavedMove.bHasRelativeViewRotation;
+	RelativeViewRotation.Rotation = SavedMove.RelativeViewRotation;
 }
 
 bool FAlsCharacterNetworkMoveData::Serialize(UCharacterMovementComponent& Movement, FArchive& Archive,
@@ -29,11 +58,97 @@ bool FAlsCharacterNetworkMoveData::Serialize(UCharacterMovementComponent& Moveme
 {
 	Super::Serialize(Movement, Archive, Map, MoveType);
 
-	NetSerializeOptionalValue(Archive.IsSaving(), Archive, RotationMode, AlsRotationModeTags::ViewDirection.GetTag(), Map);
-	NetSerializeOptionalValue(Archive.IsSaving(), Archive, Stance, AlsStanceTags::Standing.GetTag(), Map);
-	NetSerializeOptionalValue(Archive.IsSaving(), Archive, MaxAllowedGait, AlsGaitTags::Running.GetTag(), Map);
+	// The new move is always serialized first, so the pending and old moves, which almost always have the same
+	// tags as the new move, are encoded relative to it, and the new move is encoded relative to the default tags.
+
+	const auto* NewMoveData{
+		MoveType != ENetworkMoveType::NewMove
+			? static_cast<const FAlsCharacterNetworkMoveData*>(Movement.GetNetworkMoveDataContainer().GetNewMoveData()) // NOLINT(cppcoreguidelines-pro-type-static-cast-downcast)
+			: nullptr
+	};
+
+	auto bSuccess{
+		NetSerializeTag(Archive, Map, RotationMode,
+		                NewMoveData != nullptr ? NewMoveData->RotationMode : AlsRotationModeTags::ViewDirection.GetTag(),
+		                AlsCharacterMovementComponent::KnownRotationModeTags)
+	};
+
+	bSuccess &= NetSerializeTag(Archive, Map, Stance,
+	                            NewMoveData != nullptr ? NewMoveData->Stance : AlsStanceTags::Standing.GetTag(),
+	                            AlsCharacterMovementComponent::KnownStanceTags);
 
-	return !Archive.IsError();
+	bSuccess &= NetSerializeTag(Archive, Map, MaxAllowedGait,
+	                            NewMoveData != nullptr ? NewMoveData->MaxAllowedGait : AlsGaitTags::Running.GetTag(),
+	                            AlsCharacterMovementComponent::KnownGaitTags);
+
+	bSuccess &= NetSerializeRelativeViewRotation(Archive, Map);
+
+	return bSuccess && !Archive.IsError();
+}
+
+bool FAlsCharacterNetworkMoveData::NetSerializeRelativeViewRotation(FArchive& Archive, UPackageMap* Map)
+{
+	uint8 bHasRotation{bHasRelativeViewRotation};
+	Archive.SerializeBits(&bHasRotation, 1);
+
+	bHasRelativeViewRotation = bHasRotation > 0;
+
+	auto bSuccess{true};
+
+	if (bHasRelativeViewRotation)
+	{
+		RelativeViewRotation.NetSerialize(Archive, Map, bSuccess);
+	}
+
+	return bSuccess;
+}
+
+bool FAlsCharacterNetworkMoveData::NetSerializeTag(FArchive& Archive, UPackageMap* Map, FGameplayTag& Tag, const FGameplayTag& ReferenceTag,
+                                                   const TConstArrayView<const FNativeGameplayTag*> KnownTags)
+{
+	uint8 bEqualToReference{Archive.IsSaving() && Tag == ReferenceTag};
+	Archive.SerializeBits(&bEqualToReference, 1);
+
+	if (bEqualToReference)
+	{
+		Tag = ReferenceTag;
+		return true;
+	}
+
+	uint8 Index{0};
+
+	if (Archive.IsSaving())
+	{
+		Index = UnknownTagIndex;
+
+		for (auto i{0}; i < KnownTags.Num(); i++)
+		{
+			if (KnownTags[i]->GetTag() == Tag)
+			{
+				Index = static_cast<uint8>(i);
+				break;
+			}
+		}
+	}
+
+	Archive.SerializeBits(&Index, TagIndexBitsCount);
+
+	if (Index == UnknownTagIndex)
+	{
+		auto bSuccess{true};
+		Tag.NetSerialize(Archive, Map, bSuccess);
+
+		return bSuccess;
+	}
+
+	if (!KnownTags.IsValidIndex(Index))
+	{
+		Archive.SetError();
+		return false;
+	}
+
+	Tag = KnownTags[Index]->GetTag();
+	return true;
 }
 
 FAlsCharacterNetworkMoveDataContainer::FAlsCharacterNetworkMoveDataContainer()
@@ -50,6 +165,9 @@ void FAlsSavedMove::Clear()
 	RotationMode = AlsRotationModeTags::ViewDirection;
 	Stance = AlsStanceTags::Standing;
 	MaxAllowedGait = AlsGaitTags::Running;
+
+	RelativeViewRotation = FRotator::ZeroRotator;
+	bHasRelativeViewRotation = false;
 }
 
 void FAlsSavedMove::SetMoveFor(ACharacter* Character, const float NewDeltaTime, const FVector& NewAcceleration,
@@ -64,6 +182,18 @@ void FAlsSavedMove::SetMoveFor(ACharacter* Character, const float NewDeltaTime,
 		Stance = Movement->Stance;
 		MaxAllowedGait = Movement->MaxAllowedGait;
 	}
+
+	const auto* AlsCharacter{Cast<AAlsCharacter>(Character)};
+	if (IsValid(AlsCharacter))
+	{
+		bHasRelativeViewRotation = AlsCharacter->GetMovementBase().bHasRelativeRotation;
+		RelativeViewRotation = AlsCharacter->GetReplicatedViewRotation();
+	}
+
+	// This move will be added to the saved moves right after this function returns.
+
+	auto& AlsPredictionData{static_cast<FAlsNetworkPredictionData&>(PredictionData)}; // NOLINT(cppcoreguidelines-pro-type-static-cast-downcast)
+	AlsPredictionData.RefreshPeakSavedMovesCount(PredictionData.SavedMoves.Num() + 1);
 }
 
 bool FAlsSavedMove::CanCombineWith(const FSavedMovePtr& NewMovePtr, ACharacter* Character, const float MaxDeltaTime) const
@@ -114,13 +244,62 @@ void FAlsSavedMove::PrepMoveFor(ACharacter* Character)
 	}
 }
 
-FAlsNetworkPredictionData::FAlsNetworkPredictionData(const UCharacterMovementComponent& Movement) : Super{Movement} {}
+FAlsNetworkPredictionData::FAlsNetworkPredictionData(const UCharacterMovementComponent& Movement) : Super{Movement}
+{
+	// Allow the free moves list to hold the maximum number of saved moves, plus the last acknowledged move and the new
+	// move that is created when the saved moves are full, so that the engine never releases moves that are still needed.
+
+	MaxFreeMoveCount = FMath::Max(MaxFreeMoveCount, MaxSavedMoveCount + 2);
+
+	SavedMoves.Reserve(MaxSavedMoveCount);
+}
 
 FSavedMovePtr FAlsNetworkPredictionData::AllocateNewMove()
 {
+	// New moves are only allocated when the free moves list is empty. The first time this happens, the list is filled up
+	// front, so that bursts of saved moves, for example under packet loss, reuse the free moves instead of allocating.
+
+	if (!bFreeMovesFilled)
+	{
+		bFreeMovesFilled = true;
+
+		FreeMoves.Reserve(MaxFreeMoveCount);
+
+		while (FreeMoves.Num() < MaxFreeMoveCount - 1)
+		{
+			ALS_INC_COUNTER(SavedMoveAllocations);
+			FreeMoves.Add(MakeShared<FAlsSavedMove>());
+		}
+	}
+
+	ALS_INC_COUNTER(SavedMoveAllocations);
 	return MakeShared<FAlsSavedMove>();
 }
 
+void FAlsNetworkPredictionData::RefreshPeakSavedMovesCount(const int32 SavedMovesCount)
+{
+	if (SavedMovesCount > PeakSavedMovesCount)
+	{
+		PeakSavedMovesCount = SavedMovesCount;
+
+		SET_DWORD_STAT(STAT_Als_PeakSavedMoves, PeakSavedMovesCount);
+		CSV_CUSTOM_STAT(Als, PeakSavedMoves, PeakSavedMovesCount, ECsvCustomStatOp::Set);
+	}
+}
+
+bool FAlsFloorCache::Matches(const FAlsFloorCache& Other) const
+{
+	if (!bValid || !Other.bValid || MovementBaseInterfaceData != Other.MovementBaseInterfaceData || BoneName != Other.BoneName)
+	{
+		return false;
+	}
+
+	return Location.Equals(Other.Location, AlsCharacterMovementComponent::FloorCacheLocationTolerance) &&
+	       MovementBaseLocation.Equals(Other.MovementBaseLocation, AlsCharacterMovementComponent::FloorCacheLocationTolerance) &&
+	       MovementBaseRotation.Equals(Other.MovementBaseRotation, AlsCharacterMovementComponent::FloorCacheRotationTolerance) &&
+	       FMath::IsNearlyEqual(CapsuleRadius, Other.CapsuleRadius) && FMath::IsNearlyEqual(CapsuleHalfHeight, Other.CapsuleHalfHeight);
+}
+
 UAlsCharacterMovementComponent::UAlsCharacterMovementComponent()
 {
 	SetNetworkMoveDataContainer(MoveDataContainer);
@@ -235,6 +414,15 @@ void UAlsCharacterMovementComponent::OnMovementModeChanged(const EMovementMode P
 	// character automatically uncrouches at the end of the roll in the air.
 
 	bCrouchMaintainsBaseLocation = true;
+
+	FloorCache.bValid = false;
+}
+
+void UAlsCharacterMovementComponent::OnTeleported()
+{
+	Super::OnTeleported();
+
+	FloorCache.bValid = false;
 }
 
 bool UAlsCharacterMovementComponent::ShouldPerformAirControlForPathFollowing() const
@@ -312,6 +500,10 @@ void UAlsCharacterMovementComponent::ControlledCharacterMove(const FVector& Inpu
 
 void UAlsCharacterMovementComponent::PhysicsRotation(const float DeltaTime)
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsCharacterMovementComponent::PhysicsRotation"),
+	                            STAT_UAlsCharacterMovementComponent_PhysicsRotation, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	Super::PhysicsRotation(DeltaTime);
 
 	if (HasValidData() && (bRunPhysicsWithNoController || IsValid(CharacterOwner->GetController())))
@@ -332,6 +524,11 @@ void UAlsCharacterMovementComponent::MoveSmooth(const FVector& InVelocity, const
 
 void UAlsCharacterMovementComponent::PhysWalking(const float DeltaTime, int32 IterationsCount)
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsCharacterMovementComponent::PhysWalking"),
+	                            STAT_UAlsCharacterMovementComponent_PhysWalking, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+	CSV_SCOPED_TIMING_STAT(Als, PhysWalking);
+
 	RefreshGroundedMovementSettings();
 
 	auto Iterations{IterationsCount};
@@ -465,7 +662,25 @@ void UAlsCharacterMovementComponent::PhysWalking(const float DeltaTime, int32 It
 		}
 		else
 		{
-			FindFloor(UpdatedComponent->GetComponentLocation(), CurrentFloor, bZeroDelta, NULL);
+			// TODO Start of custom ALS code block.
+
+			if (!TryReuseCachedFloor(bZeroDelta))
+			{
+				FindFloor(UpdatedComponent->GetComponentLocation(), CurrentFloor, bZeroDelta, NULL);
+
+				// Only characters that haven't moved can reuse the floor, so don't capture it for moving characters.
+
+				if (bZeroDelta && CanUseFloorCache())
+				{
+					CaptureFloorCache(FloorCache);
+				}
+				else
+				{
+					FloorCache.bValid = false;
+				}
+			}
+
+			// TODO End of custom ALS code block.
 		}
 
 		// check for ledges here
@@ -628,10 +843,82 @@ void UAlsCharacterMovementComponent::PhysCustom(const float DeltaTime, int32 Ite
 	Super::PhysCustom(DeltaTime, IterationsCount);
 }
 
+bool UAlsCharacterMovementComponent::CanUseFloorCache() const
+{
+	if (!bAllowFloorCache)
+	{
+		return false;
+	}
+
+	// UCharacterMovementComponent::FindFloor() already reuses the current floor of characters that haven't moved
+	// if their movement base is a primitive that isn't movable, so the cache is only useful for other movement bases.
+
+	const auto& MovementBaseInterfaceData{CharacterOwner->GetBasedMovement().MovementBaseInterfaceData};
+
+	return MovementBaseInterfaceData.IsValid() && (MovementBaseUtility::IsDynamicBase(&MovementBaseInterfaceData) ||
+	                                               !IsValid(CharacterOwner->GetMovementBase()));
+}
+
+void UAlsCharacterMovementComponent::CaptureFloorCache(FAlsFloorCache& Cache) const
+{
+	const auto& BasedMovement{CharacterOwner->GetBasedMovement()};
+
+	Cache.MovementBaseInterfaceData = BasedMovement.MovementBaseInterfaceData;
+	Cache.BoneName = BasedMovement.BoneName;
+	Cache.Location = UpdatedComponent->GetComponentLocation();
+
+	MovementBaseUtility::GetMovementBaseTransform(&BasedMovement.MovementBaseInterfaceData, BasedMovement.BoneName,
+	                                              Cache.MovementBaseLocation, Cache.MovementBaseRotation);
+
+	CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleSize(Cache.CapsuleRadius, Cache.CapsuleHalfHeight);
+
+	Cache.Time = GetWorld()->GetTimeSeconds();
+	Cache.bValid = true;
+}
+
+bool UAlsCharacterMovementComponent::TryReuseCachedFloor(const bool bZeroDelta)
+{
+	// Only reuse the floor of characters that haven't moved in this iteration and are standing on a walkable
+	// floor, and let the character movement component force the floor search whenever it needs to.
+
+	if (bAlwaysCheckFloor || !bZeroDelta || bForceNextFloorCheck || !FloorCache.bValid || !CurrentFloor.IsWalkableFloor() ||
+	    GetWorld()->GetTimeSeconds() - FloorCache.Time >= FloorCacheRefreshInterval || !CanUseFloorCache())
+	{
+		return false;
+	}
+
+	// The floor primitive may stop blocking the character without moving, for example when its collision is disabled.
+
+	const auto* FloorPrimitive{CurrentFloor.HitResult.GetComponent()};
+
+	if (!IsValid(FloorPrimitive) || !FloorPrimitive->IsQueryCollisionEnabled() ||
+	    FloorPrimitive->GetCollisionResponseToChannel(UpdatedComponent->GetCollisionObjectType()) != ECR_Block)
+	{
+		return false;
+	}
+
+	FAlsFloorCache NewFloorCache;
+	CaptureFloorCache(NewFloorCache);
+
+	if (!FloorCache.Matches(NewFloorCache))
+	{
+		return false;
+	}
+
+	INC_DWORD_STAT(STAT_Als_FloorCacheHits);
+	return true;
+}
+
 void UAlsCharacterMovementComponent::ComputeFloorDist(const FVector& CapsuleLocation, float LineDistance,
                                                       float SweepDistance, FFindFloorResult& OutFloorResult,
                                                       float SweepRadius, const FHitResult* DownwardSweepResult) const
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsCharacterMovementComponent::ComputeFloorDist"),
+	                            STAT_UAlsCharacterMovementComponent_ComputeFloorDist, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
+	ALS_INC_COUNTER(FloorQueries);
+
 	// TODO Copied with modifications from UCharacterMovementComponent::ComputeFloorDist().
 	// TODO After the release of a new engine version, this code should be updated to match the source code.
 
@@ -869,6 +1156,12 @@ void UAlsCharacterMovementComponent::MoveAutonomous(const float ClientTimeStamp,
 		MaxAllowedGait = MoveData->MaxAllowedGait;
 
 		RefreshGaitSettings();
+
+		auto* Character{MoveData->bHasRelativeViewRotation ? Cast<AAlsCharacter>(CharacterOwner) : nullptr};
+		if (IsValid(Character))
+		{
+			Character->SetReplicatedViewRotationFromMove(MoveData->RelativeViewRotation.Rotation);
+		}
 	}
 
 	Super::MoveAutonomous(ClientTimeStamp, DeltaTime, CompressedFlags, NewAcceleration);
@@ -902,15 +1195,19 @@ void UAlsCharacterMovementComponent::SetMovementSettings(UAlsMovementSettings* N
 
 void UAlsCharacterMovementComponent::RefreshGaitSettings()
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsCharacterMovementComponent::RefreshGaitSettings"),
+	                            STAT_UAlsCharacterMovementComponent_RefreshGaitSettings, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	if (!ALS_ENSURE(IsValid(MovementSettings)))
 	{
 		return;
 	}
 
-	const auto* StanceSettings{MovementSettings->RotationModes.Find(RotationMode)};
-	const auto* NewGaitSettings{ALS_ENSURE(StanceSettings != nullptr) ? StanceSettings->Stances.Find(Stance) : nullptr};
+	GaitSettingsIndex = MovementSettings->FindGaitSettingsIndex(RotationMode, Stance);
+	GaitSettingsVersion = MovementSettings->GetGaitSettingsVersion();
 
-	GaitSettings = ALS_ENSURE(NewGaitSettings != nullptr) ? *NewGaitSettings : FAlsMovementGaitSettings{};
+	ALS_ENSURE(GaitSettingsIndex >= 0);
 }
 
 void UAlsCharacterMovementComponent::SetRotationMode(const FGameplayTag NewRotationMode)
@@ -935,6 +1232,17 @@ void UAlsCharacterMovementComponent::SetStance(const FGameplayTag NewStance)
 
 void UAlsCharacterMovementComponent::RefreshGroundedMovementSettings()
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsCharacterMovementComponent::RefreshGroundedMovementSettings"),
+	                            STAT_UAlsCharacterMovementComponent_RefreshGroundedMovementSettings, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
+	if (IsValid(MovementSettings) && GaitSettingsVersion != MovementSettings->GetGaitSettingsVersion())
+	{
+		RefreshGaitSettings();
+	}
+
+	const auto& GaitSettings{GetGaitSettings()};
+
 	auto WalkSpeed{GaitSettings.WalkForwardSpeed};
 	auto RunSpeed{GaitSettings.RunForwardSpeed};
 
@@ -1009,13 +1317,11 @@ void UAlsCharacterMovementComponent::RefreshGroundedMovementSettings()
 
 	if (ALS_ENSURE(IsValid(GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve)))
 	{
-		const auto& AccelerationAndDecelerationAndGroundFrictionCurves{
-			GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves
-		};
+		const auto& Curves{GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves};
 
-		MaxAccelerationWalking = AccelerationAndDecelerationAndGroundFrictionCurves[0].Eval(GaitAmount);
-		BrakingDecelerationWalking = AccelerationAndDecelerationAndGroundFrictionCurves[1].Eval(GaitAmount);
-		GroundFriction = AccelerationAndDecelerationAndGroundFrictionCurves[2].Eval(GaitAmount);
+		MaxAccelerationWalking = GaitSettings.AccelerationBakedCurve.Evaluate(GaitAmount, &Curves[0]);
+		BrakingDecelerationWalking = GaitSettings.DecelerationBakedCurve.Evaluate(GaitAmount, &Curves[1]);
+		GroundFriction = GaitSettings.GroundFrictionBakedCurve.Evaluate(GaitAmount, &Curves[2]);
 	}
 }
 
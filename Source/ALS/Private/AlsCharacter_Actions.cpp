@@ -2,11 +2,13 @@
 
 #include "AlsAnimationInstance.h"
 #include "AlsCharacterMovementComponent.h"
+#include "AlsLedgeIndexSubsystem.h"
 #include "DrawDebugHelpers.h"
 #include "TimerManager.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Engine/NetConnection.h"
+#include "Engine/OverlapResult.h"
 #include "Engine/SkeletalMesh.h"
 #include "Net/Core/PushModel/PushModel.h"
 #include "RootMotionSources/AlsRootMotionSource_Mantling.h"
@@ -17,6 +19,8 @@
 #include "Utility/AlsMacros.h"
 #include "Utility/AlsMontageUtility.h"
 #include "Utility/AlsRotation.h"
+#include "Utility/AlsStats.h"
+#include "Utility/AlsUtility.h"
 #include "Utility/AlsVector.h"
 
 UAnimMontage* AAlsCharacter::SelectRollMontage_Implementation()
@@ -60,6 +64,7 @@ void AAlsCharacter::StartRolling(const float TargetYawAngle, const float PlayRat
 
 	if (GetLocalRole() >= ROLE_Authority)
 	{
+		ALS_INC_COUNTER(RpcsSent);
 		MulticastStartRolling(Montage, PlayRate, InitialYawAngle, TargetYawAngle);
 	}
 	else
@@ -67,6 +72,7 @@ void AAlsCharacter::StartRolling(const float TargetYawAngle, const float PlayRat
 		GetCharacterMovement()->FlushServerMoves();
 
 		StartRollingImplementation(Montage, PlayRate, InitialYawAngle, TargetYawAngle);
+		ALS_INC_COUNTER(RpcsSent);
 		ServerStartRolling(Montage, PlayRate, InitialYawAngle, TargetYawAngle);
 	}
 }
@@ -76,6 +82,7 @@ void AAlsCharacter::ServerStartRolling_Implementation(UAnimMontage* Montage, con
 {
 	if (IsRollingAllowedToStart(Montage))
 	{
+		ALS_INC_COUNTER(RpcsSent);
 		MulticastStartRolling(Montage, PlayRate, InitialYawAngle, TargetYawAngle);
 		ForceNetUpdate();
 	}
@@ -92,6 +99,8 @@ void AAlsCharacter::StartRollingImplementation(UAnimMontage* Montage, const floa
 {
 	if (IsRollingAllowedToStart(Montage) && GetMesh()->GetAnimInstance()->Montage_Play(Montage, PlayRate) > 0.0f)
 	{
+		ALS_INC_COUNTER(MontagesPlayed);
+
 		RollingState.TargetYawAngle = TargetYawAngle;
 
 		SetRotationInstant(InitialYawAngle);
@@ -102,6 +111,9 @@ void AAlsCharacter::StartRollingImplementation(UAnimMontage* Montage, const floa
 
 void AAlsCharacter::RefreshRolling(const float DeltaTime)
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AAlsCharacter::RefreshRolling"), STAT_AAlsCharacter_RefreshRolling, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	if (GetLocalRole() <= ROLE_SimulatedProxy ||
 	    GetMesh()->GetAnimInstance()->RootMotionMode <= ERootMotionMode::IgnoreRootMotion)
 	{
@@ -115,6 +127,9 @@ void AAlsCharacter::RefreshRolling(const float DeltaTime)
 // ReSharper disable once CppMemberFunctionMayBeConst
 void AAlsCharacter::RefreshRollingPhysics(const float DeltaTime)
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AAlsCharacter::RefreshRollingPhysics"), STAT_AAlsCharacter_RefreshRollingPhysics, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	if (LocomotionAction != AlsLocomotionActionTags::Rolling)
 	{
 		return;
@@ -155,8 +170,207 @@ bool AAlsCharacter::StartMantling()
 
 bool AAlsCharacter::AutoStartMantling()
 {
-	return Settings->Mantling.bAutoStartMantlingInAir && LocomotionMode == AlsLocomotionModeTags::InAir &&
-	       IsLocallyControlled() && StartMantling(Settings->Mantling.InAirTrace);
+	if (!Settings->Mantling.bAutoStartMantlingInAir || LocomotionMode != AlsLocomotionModeTags::InAir || !IsLocallyControlled())
+	{
+		CancelAsyncMantlingTraces();
+		return false;
+	}
+
+	if (Settings->Mantling.bUseAsyncTracesForAutoStartMantling)
+	{
+		return AutoStartMantlingAsync();
+	}
+
+	CancelAsyncMantlingTraces();
+
+	return StartMantling(Settings->Mantling.InAirTrace);
+}
+
+bool AAlsCharacter::AutoStartMantlingAsync()
+{
+	static const FName ForwardTraceTag{TStringView{FAnsiString::Printf("%s (Forward Trace)", __FUNCTION__)}};
+	static const FName DownwardTraceTag{TStringView{FAnsiString::Printf("%s (Downward Trace)", __FUNCTION__)}};
+	static const FName TargetLocationTraceTag{TStringView{FAnsiString::Printf("%s (Target Location Overlap)", __FUNCTION__)}};
+	static const FName StartLocationTraceTag{TStringView{FAnsiString::Printf("%s (Start Location Overlap)", __FUNCTION__)}};
+
+	auto& TraceState{AsyncMantlingTraceState};
+	auto* World{GetWorld()};
+
+	if (TraceState.Stage == EAlsMantlingTraceStage::None)
+	{
+		if (PrepareMantlingTraces(Settings->Mantling.InAirTrace, TraceState))
+		{
+			TraceState.Stage = EAlsMantlingTraceStage::ForwardTrace;
+			ALS_INC_COUNTER(MantlingSceneQueries);
+			TraceState.TraceHandle = World->AsyncSweepByChannel(EAsyncTraceType::Single, TraceState.ForwardTraceStart,
+			                                                    TraceState.ForwardTraceEnd, FQuat::Identity,
+			                                                    Settings->Mantling.MantlingTraceChannel,
+			                                                    FCollisionShape::MakeCapsule(TraceState.TraceCapsuleRadius,
+			                                                                                 TraceState.ForwardTraceCapsuleHalfHeight),
+			                                                    {ForwardTraceTag, false, this}, Settings->Mantling.MantlingTraceResponses);
+		}
+
+		return false;
+	}
+
+	// The results of each stage become available in the next frame after the stage has started. If the character
+	// hasn't ticked for a while, the results may have already expired, in which case the traces are started over.
+
+	const auto bOverlap{TraceState.Stage >= EAlsMantlingTraceStage::TargetLocationOverlap};
+
+	FTraceDatum TraceDatum;
+	FOverlapDatum OverlapDatum;
+
+	if (bOverlap
+		    ? !World->QueryOverlapData(TraceState.TraceHandle, OverlapDatum)
+		    : !World->QueryTraceData(TraceState.TraceHandle, TraceDatum))
+	{
+		if (!World->IsTraceHandleValid(TraceState.TraceHandle, bOverlap))
+		{
+			CancelAsyncMantlingTraces();
+		}
+
+		return false;
+	}
+
+	const auto bBlockingOverlap{
+		OverlapDatum.OutOverlaps.ContainsByPredicate([](const FOverlapResult& Overlap)
+		{
+			return Overlap.bBlockingHit;
+		})
+	};
+
+	switch (TraceState.Stage)
+	{
+		case EAlsMantlingTraceStage::ForwardTrace:
+			TraceState.ForwardTraceHit = TraceDatum.OutHits.IsEmpty()
+				                             ? FHitResult{TraceState.ForwardTraceStart, TraceState.ForwardTraceEnd}
+				                             : TraceDatum.OutHits[0];
+
+			if (!ProcessMantlingForwardTrace(TraceState))
+			{
+				break;
+			}
+
+			TraceState.Stage = EAlsMantlingTraceStage::DownwardTrace;
+			ALS_INC_COUNTER(MantlingSceneQueries);
+			TraceState.TraceHandle = World->AsyncSweepByChannel(EAsyncTraceType::Single, TraceState.DownwardTraceStart,
+			                                                    TraceState.DownwardTraceEnd, FQuat::Identity,
+			                                                    Settings->Mantling.MantlingTraceChannel,
+			                                                    FCollisionShape::MakeSphere(TraceState.TraceCapsuleRadius),
+			                                                    {DownwardTraceTag, false, this}, Settings->Mantling.MantlingTraceResponses);
+			return false;
+
+		case EAlsMantlingTraceStage::DownwardTrace:
+			TraceState.DownwardTraceHit = TraceDatum.OutHits.IsEmpty()
+				                              ? FHitResult{TraceState.DownwardTraceStart, TraceState.DownwardTraceEnd}
+				                              : TraceDatum.OutHits[0];
+
+			if (!ProcessMantlingDownwardTrace(TraceState))
+			{
+				break;
+			}
+
+			TraceState.Stage = EAlsMantlingTraceStage::TargetLocationOverlap;
+			ALS_INC_COUNTER(MantlingSceneQueries);
+			TraceState.TraceHandle = World->AsyncOverlapByChannel(TraceState.TargetCapsuleLocation, FQuat::Identity,
+			                                                      Settings->Mantling.MantlingTraceChannel,
+			                                                      FCollisionShape::MakeCapsule(TraceState.CapsuleRadius,
+			                                                                                   TraceState.CapsuleHalfHeight),
+			                                                      {TargetLocationTraceTag, false, this},
+			                                                      Settings->Mantling.MantlingTraceResponses);
+			return false;
+
+		case EAlsMantlingTraceStage::TargetLocationOverlap:
+			if (bBlockingOverlap)
+			{
+				break;
+			}
+
+			TraceState.Stage = EAlsMantlingTraceStage::StartLocationOverlap;
+			ALS_INC_COUNTER(MantlingSceneQueries);
+			TraceState.TraceHandle = World->AsyncOverlapByChannel(TraceState.StartLocation, FQuat::Identity,
+			                                                      Settings->Mantling.MantlingTraceChannel,
+			                                                      FCollisionShape::MakeCapsule(TraceState.TraceCapsuleRadius,
+			                                                                                   TraceState.StartLocationTraceCapsuleHalfHeight),
+			                                                      {StartLocationTraceTag, false, this},
+			                                                      Settings->Mantling.MantlingTraceResponses);
+			return false;
+
+		case EAlsMantlingTraceStage::StartLocationOverlap:
+			if (bBlockingOverlap)
+			{
+				break;
+			}
+
+			// The world may have changed while the traces were in progress, so make sure the results are still valid.
+
+			if (IsAsyncMantlingTraceStale())
+			{
+				CancelAsyncMantlingTraces();
+				return false;
+			}
+
+			DrawMantlingTracesDebug(TraceState, true);
+			StartMantlingFromTraces(TraceState);
+			CancelAsyncMantlingTraces();
+			return true;
+
+		default:
+			break;
+	}
+
+	DrawMantlingTracesDebug(TraceState, false);
+	CancelAsyncMantlingTraces();
+	return false;
+}
+
+void AAlsCharacter::CancelAsyncMantlingTraces()
+{
+	// Results of an already started stage are simply left unused and expire on their own.
+
+	AsyncMantlingTraceState.Stage = EAlsMantlingTraceStage::None;
+	AsyncMantlingTraceState.TargetPrimitive.Reset();
+}
+
+bool AAlsCharacter::IsAsyncMantlingTraceStale() const
+{
+	const auto& TraceState{AsyncMantlingTraceState};
+	const auto* TargetPrimitive{TraceState.TargetPrimitive.Get()};
+
+	if (!Settings->Mantling.bAllowMantling || !IsMantlingAllowedToStart() || !IsValid(TargetPrimitive) ||
+	    GetWorld()->GetTimeSeconds() - TraceState.StartTime > Settings->Mantling.AsyncTraceMaxAge)
+	{
+		return true;
+	}
+
+	// The target location was found relative to the target primitive, so it is no longer valid if the primitive has moved.
+
+	static constexpr auto MaxTargetPrimitiveDisplacement{1.0f};
+
+	if (FVector::DistSquared(TargetPrimitive->GetComponentLocation(), TraceState.TargetPrimitiveLocation) >
+	    FMath::Square(MaxTargetPrimitiveDisplacement))
+	{
+		return true;
+	}
+
+	// The character keeps moving while the traces are in progress, so make
+	// sure that the ledge is still within reach of the current location.
+
+	const auto ActorLocation{GetActorLocation()};
+	const auto& TraceSettings{TraceState.TraceSettings};
+
+	const auto LedgeHeight{UE_REAL_TO_FLOAT(TraceState.TargetLocation.Z - (ActorLocation.Z - TraceState.CapsuleHalfHeight))};
+
+	if (LedgeHeight < TraceSettings.LedgeHeight.GetMin() * TraceState.CapsuleScale - UCharacterMovementComponent::MAX_FLOOR_DIST ||
+	    LedgeHeight > TraceSettings.LedgeHeight.GetMax() * TraceState.CapsuleScale + UCharacterMovementComponent::MAX_FLOOR_DIST)
+	{
+		return true;
+	}
+
+	const auto ReachDistance{TraceState.CapsuleRadius * 2.0f + (TraceSettings.ReachDistance + 1.0f) * TraceState.CapsuleScale};
+
+	return FVector::DistSquared2D(ActorLocation, TraceState.ForwardTraceHit.ImpactPoint) > FMath::Square(ReachDistance);
 }
 
 bool AAlsCharacter::IsMantlingAllowedToStart_Implementation() const
@@ -165,6 +379,115 @@ bool AAlsCharacter::IsMantlingAllowedToStart_Implementation() const
 }
 
 bool AAlsCharacter::StartMantling(const FAlsMantlingTraceSettings& TraceSettings)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AAlsCharacter::StartMantling"), STAT_AAlsCharacter_StartMantling, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
+	FAlsMantlingTraceState TraceState;
+
+	if (!PrepareMantlingTraces(TraceSettings, TraceState))
+	{
+		return false;
+	}
+
+	if (Settings->Mantling.bUseLedgeIndex)
+	{
+		// The ledge index path overwrites some of the trace parameters, so keep the original ones for the traces.
+
+		auto LedgeIndexTraceState{TraceState};
+		auto bLedgeFound{false};
+
+		if (StartMantlingFromLedgeIndex(LedgeIndexTraceState, bLedgeFound))
+		{
+			return true;
+		}
+
+		// Falling back to the traces when the indexed ledge is blocked would cost more than the traces alone.
+
+		if (bLedgeFound)
+		{
+			return false;
+		}
+	}
+
+	static const FName ForwardTraceTag{TStringView{FAnsiString::Printf("%s (Forward Trace)", __FUNCTION__)}};
+
+	FCollisionQueryParams QueryParameters{ForwardTraceTag, false, this};
+
+	// Trace forward to find an object the character cannot walk on.
+
+	TraceState.Stage = EAlsMantlingTraceStage::ForwardTrace;
+
+	ALS_INC_COUNTER(MantlingSceneQueries);
+	GetWorld()->SweepSingleByChannel(TraceState.ForwardTraceHit, TraceState.ForwardTraceStart, TraceState.ForwardTraceEnd,
+	                                 FQuat::Identity, Settings->Mantling.MantlingTraceChannel,
+	                                 FCollisionShape::MakeCapsule(TraceState.TraceCapsuleRadius, TraceState.ForwardTraceCapsuleHalfHeight),
+	                                 QueryParameters, Settings->Mantling.MantlingTraceResponses);
+
+	if (!ProcessMantlingForwardTrace(TraceState))
+	{
+		DrawMantlingTracesDebug(TraceState, false);
+		return false;
+	}
+
+	// Trace downward from the first trace's impact point and determine if the hit location is walkable.
+
+	static const FName DownwardTraceTag{TStringView{FAnsiString::Printf("%s (Downward Trace)", __FUNCTION__)}};
+
+	TraceState.Stage = EAlsMantlingTraceStage::DownwardTrace;
+
+	QueryParameters.TraceTag = DownwardTraceTag;
+
+	ALS_INC_COUNTER(MantlingSceneQueries);
+	GetWorld()->SweepSingleByChannel(TraceState.DownwardTraceHit, TraceState.DownwardTraceStart, TraceState.DownwardTraceEnd,
+	                                 FQuat::Identity, Settings->Mantling.MantlingTraceChannel,
+	                                 FCollisionShape::MakeSphere(TraceState.TraceCapsuleRadius),
+	                                 QueryParameters, Settings->Mantling.MantlingTraceResponses);
+
+	if (!ProcessMantlingDownwardTrace(TraceState))
+	{
+		DrawMantlingTracesDebug(TraceState, false);
+		return false;
+	}
+
+	// Check that there is enough free space for the capsule at the target location.
+
+	static const FName TargetLocationTraceTag{TStringView{FAnsiString::Printf("%s (Target Location Overlap)", __FUNCTION__)}};
+
+	TraceState.Stage = EAlsMantlingTraceStage::TargetLocationOverlap;
+
+	ALS_INC_COUNTER(MantlingSceneQueries);
+	if (GetWorld()->OverlapBlockingTestByChannel(TraceState.TargetCapsuleLocation, FQuat::Identity, Settings->Mantling.MantlingTraceChannel,
+	                                             FCollisionShape::MakeCapsule(TraceState.CapsuleRadius, TraceState.CapsuleHalfHeight),
+	                                             {TargetLocationTraceTag, false, this}, Settings->Mantling.MantlingTraceResponses))
+	{
+		DrawMantlingTracesDebug(TraceState, false);
+		return false;
+	}
+
+	// Perform additional overlap at the approximate start location to
+	// ensure there are no vertical obstacles on the path, such as a ceiling.
+
+	static const FName StartLocationTraceTag{TStringView{FAnsiString::Printf("%s (Start Location Overlap)", __FUNCTION__)}};
+
+	TraceState.Stage = EAlsMantlingTraceStage::StartLocationOverlap;
+
+	ALS_INC_COUNTER(MantlingSceneQueries);
+	if (GetWorld()->OverlapBlockingTestByChannel(TraceState.StartLocation, FQuat::Identity, Settings->Mantling.MantlingTraceChannel,
+	                                             FCollisionShape::MakeCapsule(TraceState.TraceCapsuleRadius,
+	                                                                          TraceState.StartLocationTraceCapsuleHalfHeight),
+	                                             {StartLocationTraceTag, false, this}, Settings->Mantling.MantlingTraceResponses))
+	{
+		DrawMantlingTracesDebug(TraceState, false);
+		return false;
+	}
+
+	DrawMantlingTracesDebug(TraceState, true);
+	StartMantlingFromTraces(TraceState);
+	return true;
+}
+
+bool AAlsCharacter::PrepareMantlingTraces(const FAlsMantlingTraceSettings& TraceSettings, FAlsMantlingTraceState& TraceState) const
 {
 	if (!Settings->Mantling.bAllowMantling || GetLocalRole() <= ROLE_SimulatedProxy || !IsMantlingAllowedToStart())
 	{
@@ -199,40 +522,140 @@ bool AAlsCharacter::StartMantling(const FAlsMantlingTraceSettings& TraceSettings
 			ActorYawAngle + FMath::ClampAngle(ForwardTraceDeltaAngle, -Settings->Mantling.MaxReachAngle, Settings->Mantling.MaxReachAngle))
 	};
 
-#if ENABLE_DRAW_DEBUG
-	const auto bDisplayDebug{UAlsDebugUtility::ShouldDisplayDebugForActor(this, UAlsConstants::MantlingDebugDisplayName())};
-#endif
-
 	const auto* Capsule{GetCapsuleComponent()};
 
-	const auto CapsuleScale{Capsule->GetComponentScale().Z};
-	const auto CapsuleRadius{Capsule->GetScaledCapsuleRadius()};
-	const auto CapsuleHalfHeight{Capsule->GetScaledCapsuleHalfHeight()};
+	TraceState.TraceSettings = TraceSettings;
+	TraceState.Stage = EAlsMantlingTraceStage::None;
+	TraceState.StartTime = GetWorld()->GetTimeSeconds();
 
-	const FVector CapsuleBottomLocation{ActorLocation.X, ActorLocation.Y, ActorLocation.Z - CapsuleHalfHeight};
+	TraceState.CapsuleScale = Capsule->GetComponentScale().Z;
+	TraceState.CapsuleRadius = Capsule->GetScaledCapsuleRadius();
+	TraceState.CapsuleHalfHeight = Capsule->GetScaledCapsuleHalfHeight();
 
-	const auto TraceCapsuleRadius{CapsuleRadius - 1.0f};
+	TraceState.CapsuleBottomLocation = {ActorLocation.X, ActorLocation.Y, ActorLocation.Z - TraceState.CapsuleHalfHeight};
 
-	const auto LedgeHeightDelta{UE_REAL_TO_FLOAT((TraceSettings.LedgeHeight.GetMax() - TraceSettings.LedgeHeight.GetMin()) * CapsuleScale)};
+	TraceState.TraceCapsuleRadius = TraceState.CapsuleRadius - 1.0f;
 
-	// Trace forward to find an object the character cannot walk on.
+	TraceState.LedgeHeightDelta = UE_REAL_TO_FLOAT((TraceSettings.LedgeHeight.GetMax() - TraceSettings.LedgeHeight.GetMin()) *
+	                                               TraceState.CapsuleScale);
 
-	static const FName ForwardTraceTag{TStringView{FAnsiString::Printf("%s (Forward Trace)", __FUNCTION__)}};
+	TraceState.ForwardTraceStart = TraceState.CapsuleBottomLocation - ForwardTraceDirection * TraceState.CapsuleRadius;
+	TraceState.ForwardTraceStart.Z += (TraceSettings.LedgeHeight.X + TraceSettings.LedgeHeight.Y) *
+		0.5f * TraceState.CapsuleScale - UCharacterMovementComponent::MAX_FLOOR_DIST;
 
-	auto ForwardTraceStart{CapsuleBottomLocation - ForwardTraceDirection * CapsuleRadius};
-	ForwardTraceStart.Z += (TraceSettings.LedgeHeight.X + TraceSettings.LedgeHeight.Y) *
-		0.5f * CapsuleScale - UCharacterMovementComponent::MAX_FLOOR_DIST;
+	TraceState.ForwardTraceEnd = TraceState.ForwardTraceStart + ForwardTraceDirection *
+	                             (TraceState.CapsuleRadius + (TraceSettings.ReachDistance + 1.0f) * TraceState.CapsuleScale);
 
-	auto ForwardTraceEnd{ForwardTraceStart + ForwardTraceDirection * (CapsuleRadius + (TraceSettings.ReachDistance + 1.0f) * CapsuleScale)};
+	TraceState.ForwardTraceCapsuleHalfHeight = TraceState.LedgeHeightDelta * 0.5f;
 
-	const auto ForwardTraceCapsuleHalfHeight{LedgeHeightDelta * 0.5f};
+	return true;
+}
 
-	FHitResult ForwardTraceHit;
-	GetWorld()->SweepSingleByChannel(ForwardTraceHit, ForwardTraceStart, ForwardTraceEnd,
-	                                 FQuat::Identity, Settings->Mantling.MantlingTraceChannel,
-	                                 FCollisionShape::MakeCapsule(TraceCapsuleRadius, ForwardTraceCapsuleHalfHeight),
-	                                 {ForwardTraceTag, false, this}, Settings->Mantling.MantlingTraceResponses);
+bool AAlsCharacter::StartMantlingFromLedgeIndex(FAlsMantlingTraceState& TraceState, bool& bLedgeFound)
+{
+	bLedgeFound = false;
+
+	auto* LedgeIndex{GetWorld()->GetSubsystem<UAlsLedgeIndexSubsystem>()};
+	if (!IsValid(LedgeIndex))
+	{
+		return false;
+	}
+
+	const auto& TraceSettings{TraceState.TraceSettings};
+	const auto WalkableFloorZ{GetCharacterMovement()->GetWalkableFloorZ()};
+
+	// Match the area covered by the forward and downward traces.
+
+	FAlsLedgeQuery Query;
+	Query.Location = TraceState.CapsuleBottomLocation;
+	Query.Direction = (TraceState.ForwardTraceEnd - TraceState.ForwardTraceStart).GetSafeNormal2D();
+	Query.MaxDistance = (TraceSettings.ReachDistance + 1.0f) * TraceState.CapsuleScale + TraceState.TraceCapsuleRadius;
+	Query.HalfWidth = TraceState.TraceCapsuleRadius;
+	Query.MinHeight = TraceSettings.LedgeHeight.GetMin() * TraceState.CapsuleScale - UCharacterMovementComponent::MAX_FLOOR_DIST;
+	Query.MaxHeight = TraceSettings.LedgeHeight.GetMax() * TraceState.CapsuleScale;
+	Query.MinTopNormalZ = FMath::Max(Settings->Mantling.SlopeAngleThresholdCos, WalkableFloorZ);
+	Query.MaxSideNormalZ = WalkableFloorZ;
+	Query.TraceChannel = Settings->Mantling.MantlingTraceChannel;
+	Query.TraceResponses = Settings->Mantling.MantlingTraceResponses;
+
+	const FAlsLedge* Ledge;
+	FVector LedgeLocation;
+
+	if (!LedgeIndex->FindLedge(Query, Ledge, LedgeLocation) || !Ledge->Primitive->CanCharacterStepUp(this))
+	{
+		return false;
+	}
+
+	bLedgeFound = true;
+
+	auto* TargetPrimitive{Ledge->Primitive.Get()};
+
+	TraceState.TargetPrimitive = TargetPrimitive;
+	TraceState.TargetPrimitiveLocation = TargetPrimitive->GetComponentLocation();
+	TraceState.TargetDirection = -Ledge->Direction;
+
+	TraceState.ForwardTraceHit = FHitResult{TargetPrimitive->GetOwner(), TargetPrimitive, LedgeLocation, Ledge->Direction};
+
+	// Project the target location onto the plane of the top surface of the ledge.
+
+	const FVector2D TargetLocationOffset{TraceState.TargetDirection * (TraceSettings.TargetLocationOffset * TraceState.CapsuleScale)};
+
+	TraceState.TargetLocation = {
+		LedgeLocation.X + TargetLocationOffset.X,
+		LedgeLocation.Y + TargetLocationOffset.Y,
+		LedgeLocation.Z - (Ledge->TopNormal.X * TargetLocationOffset.X + Ledge->TopNormal.Y * TargetLocationOffset.Y) /
+		Ledge->TopNormal.Z + UCharacterMovementComponent::MIN_FLOOR_DIST
+	};
+
+	TraceState.TargetCapsuleLocation = {
+		TraceState.TargetLocation.X,
+		TraceState.TargetLocation.Y,
+		TraceState.TargetLocation.Z + TraceState.CapsuleHalfHeight
+	};
+
+	// Indexed ledges belong to static geometry, which can't have changed since it was indexed, so the ledge is used as is.
+	// Only if the primitive has been made movable since then, make sure with a single overlap that there is still enough
+	// free space for the capsule at the target location.
+
+	auto bBlocked{false};
+
+	if (TargetPrimitive->Mobility != EComponentMobility::Static)
+	{
+		static const FName TargetLocationTraceTag{TStringView{FAnsiString::Printf("%s (Target Location Overlap)", __FUNCTION__)}};
 
+		TraceState.Stage = EAlsMantlingTraceStage::TargetLocationOverlap;
+
+		ALS_INC_COUNTER(MantlingSceneQueries);
+		bBlocked = GetWorld()->OverlapBlockingTestByChannel(TraceState.TargetCapsuleLocation, FQuat::Identity,
+		                                                    Settings->Mantling.MantlingTraceChannel,
+		                                                    FCollisionShape::MakeCapsule(TraceState.CapsuleRadius, TraceState.CapsuleHalfHeight),
+		                                                    {TargetLocationTraceTag, false, this},
+		                                                    Settings->Mantling.MantlingTraceResponses);
+	}
+
+#if ENABLE_DRAW_DEBUG
+	if (UAlsDebugUtility::ShouldDisplayDebugForActor(this, UAlsConstants::MantlingDebugDisplayName()) &&
+	    (!bBlocked || TraceSettings.bDrawFailedTraces))
+	{
+		DrawDebugLine(GetWorld(), Ledge->Start, Ledge->End, FLinearColor{0.0f, 0.75f, 1.0f}.ToFColor(true), false, 5.0f);
+
+		DrawDebugCapsule(GetWorld(), TraceState.TargetCapsuleLocation, TraceState.CapsuleHalfHeight, TraceState.CapsuleRadius,
+		                 FQuat::Identity, bBlocked ? FColor::Red : FColor::Green, false, bBlocked ? 10.0f : 5.0f);
+	}
+#endif
+
+	if (bBlocked)
+	{
+		return false;
+	}
+
+	StartMantlingFromTraces(TraceState);
+	return true;
+}
+
+bool AAlsCharacter::ProcessMantlingForwardTrace(FAlsMantlingTraceState& TraceState)
+{
+	const auto& ForwardTraceHit{TraceState.ForwardTraceHit};
 	auto* TargetPrimitive{ForwardTraceHit.GetComponent()};
 
 	if (!ForwardTraceHit.IsValidBlockingHit() ||
@@ -241,43 +664,35 @@ bool AAlsCharacter::StartMantling(const FAlsMantlingTraceSettings& TraceSettings
 	    !TargetPrimitive->CanCharacterStepUp(this) ||
 	    GetCharacterMovement()->IsWalkable(ForwardTraceHit))
 	{
-#if ENABLE_DRAW_DEBUG
-		if (bDisplayDebug)
-		{
-			UAlsDebugUtility::DrawSweepSingleCapsuleAlternative(GetWorld(), ForwardTraceStart, ForwardTraceEnd, TraceCapsuleRadius,
-			                                                    ForwardTraceCapsuleHalfHeight, false, ForwardTraceHit, {0.0f, 0.25f, 1.0f},
-			                                                    {0.0f, 0.75f, 1.0f}, TraceSettings.bDrawFailedTraces ? 5.0f : 0.0f);
-		}
-#endif
-
 		return false;
 	}
 
-	const auto TargetDirection{-ForwardTraceHit.ImpactNormal.GetSafeNormal2D()};
+	TraceState.TargetPrimitive = TargetPrimitive;
+	TraceState.TargetPrimitiveLocation = TargetPrimitive->GetComponentLocation();
+	TraceState.TargetDirection = -ForwardTraceHit.ImpactNormal.GetSafeNormal2D();
 
-	// Trace downward from the first trace's impact point and determine if the hit location is walkable.
+	const FVector2D TargetLocationOffset{TraceState.TargetDirection * (TraceState.TraceSettings.TargetLocationOffset * TraceState.CapsuleScale)};
 
-	static const FName DownwardTraceTag{TStringView{FAnsiString::Printf("%s (Downward Trace)", __FUNCTION__)}};
-
-	const FVector2D TargetLocationOffset{TargetDirection * (TraceSettings.TargetLocationOffset * CapsuleScale)};
-
-	const FVector DownwardTraceStart{
+	TraceState.DownwardTraceStart = {
 		ForwardTraceHit.ImpactPoint.X + TargetLocationOffset.X,
 		ForwardTraceHit.ImpactPoint.Y + TargetLocationOffset.Y,
-		CapsuleBottomLocation.Z + LedgeHeightDelta + 2.5f * TraceCapsuleRadius + UCharacterMovementComponent::MIN_FLOOR_DIST
+		TraceState.CapsuleBottomLocation.Z + TraceState.LedgeHeightDelta +
+		2.5f * TraceState.TraceCapsuleRadius + UCharacterMovementComponent::MIN_FLOOR_DIST
 	};
 
-	const FVector DownwardTraceEnd{
-		DownwardTraceStart.X,
-		DownwardTraceStart.Y,
-		CapsuleBottomLocation.Z +
-		TraceSettings.LedgeHeight.GetMin() * CapsuleScale + TraceCapsuleRadius - UCharacterMovementComponent::MAX_FLOOR_DIST
+	TraceState.DownwardTraceEnd = {
+		TraceState.DownwardTraceStart.X,
+		TraceState.DownwardTraceStart.Y,
+		TraceState.CapsuleBottomLocation.Z + TraceState.TraceSettings.LedgeHeight.GetMin() * TraceState.CapsuleScale +
+		TraceState.TraceCapsuleRadius - UCharacterMovementComponent::MAX_FLOOR_DIST
 	};
 
-	FHitResult DownwardTraceHit;
-	GetWorld()->SweepSingleByChannel(DownwardTraceHit, DownwardTraceStart, DownwardTraceEnd, FQuat::Identity,
-	                                 Settings->Mantling.MantlingTraceChannel, FCollisionShape::MakeSphere(TraceCapsuleRadius),
-	                                 {DownwardTraceTag, false, this}, Settings->Mantling.MantlingTraceResponses);
+	return true;
+}
+
+bool AAlsCharacter::ProcessMantlingDownwardTrace(FAlsMantlingTraceState& TraceState)
+{
+	const auto& DownwardTraceHit{TraceState.DownwardTraceHit};
 
 	const auto SlopeAngleCos{UE_REAL_TO_FLOAT(DownwardTraceHit.ImpactNormal.Z)};
 
@@ -294,117 +709,49 @@ bool AAlsCharacter::StartMantling(const FAlsMantlingTraceSettings& TraceSettings
 	    ApproximateSlopeAngleCos < Settings->Mantling.SlopeAngleThresholdCos ||
 	    !GetCharacterMovement()->IsWalkable(DownwardTraceHit))
 	{
-#if ENABLE_DRAW_DEBUG
-		if (bDisplayDebug)
-		{
-			UAlsDebugUtility::DrawSweepSingleCapsuleAlternative(GetWorld(), ForwardTraceStart, ForwardTraceEnd, TraceCapsuleRadius,
-			                                                    ForwardTraceCapsuleHalfHeight, true, ForwardTraceHit, {0.0f, 0.25f, 1.0f},
-			                                                    {0.0f, 0.75f, 1.0f}, TraceSettings.bDrawFailedTraces ? 5.0f : 0.0f);
-
-			UAlsDebugUtility::DrawSweepSingleSphere(GetWorld(), DownwardTraceStart, DownwardTraceEnd, TraceCapsuleRadius,
-			                                        false, DownwardTraceHit, {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f},
-			                                        TraceSettings.bDrawFailedTraces ? 7.5f : 0.0f);
-		}
-#endif
-
 		return false;
 	}
 
-	// Check that there is enough free space for the capsule at the target location.
-
-	static const FName TargetLocationTraceTag{TStringView{FAnsiString::Printf("%s (Target Location Overlap)", __FUNCTION__)}};
-
-	const FVector TargetLocation{
+	TraceState.TargetLocation = {
 		DownwardTraceHit.Location.X,
 		DownwardTraceHit.Location.Y,
 		DownwardTraceHit.ImpactPoint.Z + UCharacterMovementComponent::MIN_FLOOR_DIST
 	};
 
-	const FVector TargetCapsuleLocation{TargetLocation.X, TargetLocation.Y, TargetLocation.Z + CapsuleHalfHeight};
-
-	if (GetWorld()->OverlapBlockingTestByChannel(TargetCapsuleLocation, FQuat::Identity, Settings->Mantling.MantlingTraceChannel,
-	                                             FCollisionShape::MakeCapsule(CapsuleRadius, CapsuleHalfHeight),
-	                                             {TargetLocationTraceTag, false, this}, Settings->Mantling.MantlingTraceResponses))
-	{
-#if ENABLE_DRAW_DEBUG
-		if (bDisplayDebug)
-		{
-			UAlsDebugUtility::DrawSweepSingleCapsuleAlternative(GetWorld(), ForwardTraceStart, ForwardTraceEnd, TraceCapsuleRadius,
-			                                                    ForwardTraceCapsuleHalfHeight, true, ForwardTraceHit, {0.0f, 0.25f, 1.0f},
-			                                                    {0.0f, 0.75f, 1.0f}, TraceSettings.bDrawFailedTraces ? 5.0f : 0.0f);
-
-			UAlsDebugUtility::DrawSweepSingleSphere(GetWorld(), DownwardTraceStart, DownwardTraceEnd, TraceCapsuleRadius,
-			                                        false, DownwardTraceHit, {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f},
-			                                        TraceSettings.bDrawFailedTraces ? 7.5f : 0.0f);
-
-			DrawDebugCapsule(GetWorld(), TargetCapsuleLocation, CapsuleHalfHeight, CapsuleRadius, FQuat::Identity,
-			                 FColor::Red, false, TraceSettings.bDrawFailedTraces ? 10.0f : 0.0f);
-		}
-#endif
-
-		return false;
-	}
-
-	// Perform additional overlap at the approximate start location to
-	// ensure there are no vertical obstacles on the path, such as a ceiling.
-
-	static const FName StartLocationTraceTag{TStringView{FAnsiString::Printf("%s (Start Location Overlap)", __FUNCTION__)}};
-
-	const FVector2D StartLocationOffset{TargetDirection * (TraceSettings.StartLocationOffset * CapsuleScale)};
-
-	const FVector StartLocation{
-		ForwardTraceHit.ImpactPoint.X - StartLocationOffset.X,
-		ForwardTraceHit.ImpactPoint.Y - StartLocationOffset.Y,
-		(DownwardTraceHit.Location.Z + DownwardTraceEnd.Z) * 0.5f
-	};
-
-	const auto StartLocationTraceCapsuleHalfHeight{
-		UE_REAL_TO_FLOAT(DownwardTraceHit.Location.Z - DownwardTraceEnd.Z) * 0.5f + TraceCapsuleRadius
+	TraceState.TargetCapsuleLocation = {
+		TraceState.TargetLocation.X,
+		TraceState.TargetLocation.Y,
+		TraceState.TargetLocation.Z + TraceState.CapsuleHalfHeight
 	};
 
-	if (GetWorld()->OverlapBlockingTestByChannel(StartLocation, FQuat::Identity, Settings->Mantling.MantlingTraceChannel,
-	                                             FCollisionShape::MakeCapsule(TraceCapsuleRadius, StartLocationTraceCapsuleHalfHeight),
-	                                             {StartLocationTraceTag, false, this}, Settings->Mantling.MantlingTraceResponses))
-	{
-#if ENABLE_DRAW_DEBUG
-		if (bDisplayDebug)
-		{
-			UAlsDebugUtility::DrawSweepSingleCapsuleAlternative(GetWorld(), ForwardTraceStart, ForwardTraceEnd, TraceCapsuleRadius,
-			                                                    ForwardTraceCapsuleHalfHeight, true, ForwardTraceHit,
-			                                                    {0.0f, 0.25f, 1.0f},
-			                                                    {0.0f, 0.75f, 1.0f}, TraceSettings.bDrawFailedTraces ? 5.0f : 0.0f);
+	const FVector2D StartLocationOffset{TraceState.TargetDirection * (TraceState.TraceSettings.StartLocationOffset * TraceState.CapsuleScale)};
 
-			UAlsDebugUtility::DrawSweepSingleSphere(GetWorld(), DownwardTraceStart, DownwardTraceEnd, TraceCapsuleRadius,
-			                                        false, DownwardTraceHit, {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f},
-			                                        TraceSettings.bDrawFailedTraces ? 7.5f : 0.0f);
+	TraceState.StartLocation = {
+		TraceState.ForwardTraceHit.ImpactPoint.X - StartLocationOffset.X,
+		TraceState.ForwardTraceHit.ImpactPoint.Y - StartLocationOffset.Y,
+		(DownwardTraceHit.Location.Z + TraceState.DownwardTraceEnd.Z) * 0.5f
+	};
 
-			DrawDebugCapsule(GetWorld(), StartLocation, StartLocationTraceCapsuleHalfHeight, TraceCapsuleRadius, FQuat::Identity,
-			                 FLinearColor{1.0f, 0.5f, 0.0f}.ToFColor(true), false, TraceSettings.bDrawFailedTraces ? 10.0f : 0.0f);
-		}
-#endif
+	TraceState.StartLocationTraceCapsuleHalfHeight =
+		UE_REAL_TO_FLOAT(DownwardTraceHit.Location.Z - TraceState.DownwardTraceEnd.Z) * 0.5f + TraceState.TraceCapsuleRadius;
 
-		return false;
-	}
+	return true;
+}
 
-#if ENABLE_DRAW_DEBUG
-	if (bDisplayDebug)
-	{
-		UAlsDebugUtility::DrawSweepSingleCapsuleAlternative(GetWorld(), ForwardTraceStart, ForwardTraceEnd, TraceCapsuleRadius,
-		                                                    ForwardTraceCapsuleHalfHeight, true, ForwardTraceHit,
-		                                                    {0.0f, 0.25f, 1.0f}, {0.0f, 0.75f, 1.0f}, 5.0f);
+void AAlsCharacter::StartMantlingFromTraces(const FAlsMantlingTraceState& TraceState)
+{
+	auto* TargetPrimitive{TraceState.TargetPrimitive.Get()};
+	const auto TargetRotation{TraceState.TargetDirection.ToOrientationQuat()};
 
-		UAlsDebugUtility::DrawSweepSingleSphere(GetWorld(), DownwardTraceStart, DownwardTraceEnd,
-		                                        TraceCapsuleRadius, true, DownwardTraceHit,
-		                                        {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f}, 7.5f);
-	}
-#endif
+	// The mantling height is calculated from the current location, since with asynchronous
+	// traces the character may have moved a bit since the traces were started.
 
-	const auto TargetRotation{TargetDirection.ToOrientationQuat()};
+	const auto CapsuleBottomLocationZ{GetActorLocation().Z - TraceState.CapsuleHalfHeight};
 
 	FAlsMantlingParameters Parameters;
 
 	Parameters.TargetPrimitive = TargetPrimitive;
-	Parameters.MantlingHeight = UE_REAL_TO_FLOAT((TargetLocation.Z - CapsuleBottomLocation.Z) / CapsuleScale);
+	Parameters.MantlingHeight = UE_REAL_TO_FLOAT((TraceState.TargetLocation.Z - CapsuleBottomLocationZ) / TraceState.CapsuleScale);
 
 	// Determine the mantling type by checking the movement mode and mantling height.
 
@@ -420,7 +767,7 @@ bool AAlsCharacter::StartMantling(const FAlsMantlingTraceSettings& TraceSettings
 	if (MovementBaseUtility::UseRelativeLocation(&MovementBaseData))
 	{
 		const auto TargetTransform{
-			FTransform{TargetRotation, TargetCapsuleLocation}.GetRelativeTransform(TargetPrimitive->GetComponentTransform())
+			FTransform{TargetRotation, TraceState.TargetCapsuleLocation}.GetRelativeTransform(TargetPrimitive->GetComponentTransform())
 		};
 
 		Parameters.TargetLocation = TargetTransform.GetLocation();
@@ -428,12 +775,13 @@ bool AAlsCharacter::StartMantling(const FAlsMantlingTraceSettings& TraceSettings
 	}
 	else
 	{
-		Parameters.TargetLocation = TargetCapsuleLocation;
+		Parameters.TargetLocation = TraceState.TargetCapsuleLocation;
 		Parameters.TargetRotation = TargetRotation.Rotator();
 	}
 
 	if (GetLocalRole() >= ROLE_Authority)
 	{
+		ALS_INC_COUNTER(RpcsSent);
 		MulticastStartMantling(Parameters);
 	}
 	else
@@ -441,16 +789,70 @@ bool AAlsCharacter::StartMantling(const FAlsMantlingTraceSettings& TraceSettings
 		GetCharacterMovement()->FlushServerMoves();
 
 		StartMantlingImplementation(Parameters);
+		ALS_INC_COUNTER(RpcsSent);
 		ServerStartMantling(Parameters);
 	}
+}
 
-	return true;
+void AAlsCharacter::DrawMantlingTracesDebug(const FAlsMantlingTraceState& TraceState, const bool bSuccess) const
+{
+#if ENABLE_DRAW_DEBUG
+	if (!UAlsDebugUtility::ShouldDisplayDebugForActor(this, UAlsConstants::MantlingDebugDisplayName()))
+	{
+		return;
+	}
+
+	if (bSuccess)
+	{
+		UAlsDebugUtility::DrawSweepSingleCapsuleAlternative(GetWorld(), TraceState.ForwardTraceStart, TraceState.ForwardTraceEnd,
+		                                                    TraceState.TraceCapsuleRadius, TraceState.ForwardTraceCapsuleHalfHeight,
+		                                                    true, TraceState.ForwardTraceHit,
+		                                                    {0.0f, 0.25f, 1.0f}, {0.0f, 0.75f, 1.0f}, 5.0f);
+
+		UAlsDebugUtility::DrawSweepSingleSphere(GetWorld(), TraceState.DownwardTraceStart, TraceState.DownwardTraceEnd,
+		                                        TraceState.TraceCapsuleRadius, true, TraceState.DownwardTraceHit,
+		                                        {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f}, 7.5f);
+		return;
+	}
+
+	// The traces failed at the current stage, so draw everything up to and including it.
+
+	const auto bDrawFailedTraces{TraceState.TraceSettings.bDrawFailedTraces};
+
+	UAlsDebugUtility::DrawSweepSingleCapsuleAlternative(GetWorld(), TraceState.ForwardTraceStart, TraceState.ForwardTraceEnd,
+	                                                    TraceState.TraceCapsuleRadius, TraceState.ForwardTraceCapsuleHalfHeight,
+	                                                    TraceState.Stage != EAlsMantlingTraceStage::ForwardTrace,
+	                                                    TraceState.ForwardTraceHit, {0.0f, 0.25f, 1.0f},
+	                                                    {0.0f, 0.75f, 1.0f}, bDrawFailedTraces ? 5.0f : 0.0f);
+
+	if (TraceState.Stage == EAlsMantlingTraceStage::ForwardTrace)
+	{
+		return;
+	}
+
+	UAlsDebugUtility::DrawSweepSingleSphere(GetWorld(), TraceState.DownwardTraceStart, TraceState.DownwardTraceEnd,
+	                                        TraceState.TraceCapsuleRadius, false, TraceState.DownwardTraceHit,
+	                                        {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f}, bDrawFailedTraces ? 7.5f : 0.0f);
+
+	if (TraceState.Stage == EAlsMantlingTraceStage::TargetLocationOverlap)
+	{
+		DrawDebugCapsule(GetWorld(), TraceState.TargetCapsuleLocation, TraceState.CapsuleHalfHeight, TraceState.CapsuleRadius,
+		                 FQuat::Identity, FColor::Red, false, bDrawFailedTraces ? 10.0f : 0.0f);
+	}
+	else if (TraceState.Stage == EAlsMantlingTraceStage::StartLocationOverlap)
+	{
+		DrawDebugCapsule(GetWorld(), TraceState.StartLocation, TraceState.StartLocationTraceCapsuleHalfHeight,
+		                 TraceState.TraceCapsuleRadius, FQuat::Identity, FLinearColor{1.0f, 0.5f, 0.0f}.ToFColor(true),
+		                 false, bDrawFailedTraces ? 10.0f : 0.0f);
+	}
+#endif
 }
 
 void AAlsCharacter::ServerStartMantling_Implementation(const FAlsMantlingParameters& Parameters)
 {
 	if (IsMantlingAllowedToStart())
 	{
+		ALS_INC_COUNTER(RpcsSent);
 		MulticastStartMantling(Parameters);
 		ForceNetUpdate();
 	}
@@ -568,6 +970,8 @@ void AAlsCharacter::StartMantlingImplementation(const FAlsMantlingParameters& Pa
 
 	if (GetMesh()->GetAnimInstance()->Montage_Play(MantlingSettings->Montage) > 0.0f)
 	{
+		ALS_INC_COUNTER(MontagesPlayed);
+
 		SetLocomotionAction(AlsLocomotionActionTags::Mantling);
 	}
 
@@ -645,6 +1049,9 @@ void AAlsCharacter::OnMantlingStarted_Implementation(const FAlsMantlingParameter
 
 void AAlsCharacter::RefreshMantling()
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AAlsCharacter::RefreshMantling"), STAT_AAlsCharacter_RefreshMantling, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	if (MantlingState.RootMotionSourceId <= 0)
 	{
 		return;
@@ -732,12 +1139,14 @@ void AAlsCharacter::StartRagdolling()
 
 	if (GetLocalRole() >= ROLE_Authority)
 	{
+		ALS_INC_COUNTER(RpcsSent);
 		MulticastStartRagdolling();
 	}
 	else
 	{
 		GetCharacterMovement()->FlushServerMoves();
 
+		ALS_INC_COUNTER(RpcsSent);
 		ServerStartRagdolling();
 	}
 }
@@ -746,6 +1155,7 @@ void AAlsCharacter::ServerStartRagdolling_Implementation()
 {
 	if (IsRagdollingAllowedToStart())
 	{
+		ALS_INC_COUNTER(RpcsSent);
 		MulticastStartRagdolling();
 		ForceNetUpdate();
 	}
@@ -855,6 +1265,7 @@ void AAlsCharacter::SetRagdollTargetLocation(const FVector& NewTargetLocation)
 
 		if (GetLocalRole() == ROLE_AutonomousProxy)
 		{
+			ALS_INC_COUNTER(RpcsSent);
 			ServerSetRagdollTargetLocation(RagdollTargetLocation);
 		}
 	}
@@ -867,6 +1278,9 @@ void AAlsCharacter::ServerSetRagdollTargetLocation_Implementation(const FVector_
 
 void AAlsCharacter::RefreshRagdolling(const float DeltaTime)
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AAlsCharacter::RefreshRagdolling"), STAT_AAlsCharacter_RefreshRagdolling, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	if (LocomotionAction != AlsLocomotionActionTags::Ragdolling)
 	{
 		return;
@@ -980,6 +1394,7 @@ FVector AAlsCharacter::RagdollTraceGround(bool& bGrounded) const
 	GetCharacterMovement()->InitCollisionParams(QueryParameters, CollisionResponses);
 
 	FHitResult Hit;
+	ALS_INC_COUNTER(RagdollingSceneQueries);
 	bGrounded = GetWorld()->SweepSingleByChannel(Hit, TraceStart, TraceEnd, FQuat::Identity,
 	                                             CollisionChannel, FCollisionShape::MakeSphere(CapsuleRadius),
 	                                             QueryParameters, CollisionResponses);
@@ -1037,10 +1452,12 @@ bool AAlsCharacter::StopRagdolling()
 
 	if (GetLocalRole() >= ROLE_Authority)
 	{
+		ALS_INC_COUNTER(RpcsSent);
 		MulticastStopRagdolling();
 	}
 	else
 	{
+		ALS_INC_COUNTER(RpcsSent);
 		ServerStopRagdolling();
 	}
 
@@ -1051,6 +1468,7 @@ void AAlsCharacter::ServerStopRagdolling_Implementation()
 {
 	if (IsRagdollingAllowedToStop())
 	{
+		ALS_INC_COUNTER(RpcsSent);
 		MulticastStopRagdolling();
 		ForceNetUpdate();
 	}
@@ -1158,6 +1576,8 @@ void AAlsCharacter::StopRagdollingImplementation()
 
 	if (bGrounded && GetMesh()->GetAnimInstance()->Montage_Play(SelectGetUpMontage(bRagdollFacingUpward)) > 0.0f)
 	{
+		ALS_INC_COUNTER(MontagesPlayed);
+
 		AlsCharacterMovement->SetInputBlocked(true);
 
 		SetLocomotionAction(AlsLocomotionActionTags::GettingUp);
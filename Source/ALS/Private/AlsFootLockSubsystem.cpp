@@ -0,0 +1,293 @@
+#include "AlsFootLockSubsystem.h"
+
+#include "AlsAnimationInstance.h"
+#include "AlsCharacter.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Settings/AlsAnimationInstanceSettings.h"
+#include "Settings/AlsCharacterSettings.h"
+#include "Utility/AlsGameplayTags.h"
+#include "Utility/AlsMacros.h"
+#include "Utility/AlsUtility.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsFootLockSubsystem)
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Foot Lock Batch Feet"), STAT_Als_FootLockBatchFeet, STATGROUP_Als)
+
+void FAlsFootLockTickFunction::ExecuteTick(const float DeltaTime, const ELevelTick TickType, ENamedThreads::Type CurrentThread,
+                                           const FGraphEventRef& CompletionGraphEvent)
+{
+	if (TickType != LEVELTICK_ViewportsOnly && Subsystem.IsValid() && Group != nullptr)
+	{
+		Subsystem->RefreshGroup(*Group, DeltaTime, CompletionGraphEvent);
+	}
+}
+
+FString FAlsFootLockTickFunction::DiagnosticMessage()
+{
+	return FString{ANSITEXTVIEW("UAlsFootLockSubsystem::TickFunction")};
+}
+
+void UAlsFootLockSubsystem::Deinitialize()
+{
+	for (const auto& Group : Groups)
+	{
+		if (Group->TickFunction.IsTickFunctionRegistered())
+		{
+			Group->TickFunction.UnRegisterTickFunction();
+		}
+	}
+
+	Groups.Reset();
+
+	Super::Deinitialize();
+}
+
+bool UAlsFootLockSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAlsFootLockSubsystem::RegisterAnimationInstance(UAlsAnimationInstance* AnimationInstance)
+{
+	if (!ALS_ENSURE(IsValid(AnimationInstance)) || FindGroup(AnimationInstance) != nullptr)
+	{
+		return;
+	}
+
+	auto* Character{AnimationInstance->Character.Get()};
+	auto* Mesh{AnimationInstance->GetSkelMeshComponent()};
+
+	if (!IsValid(Character) || !IsValid(Mesh))
+	{
+		return;
+	}
+
+	FAlsFootLockGroup* Group{nullptr};
+
+	for (const auto& ExistingGroup : Groups)
+	{
+		if (ExistingGroup->AnimationInstances.Num() < FAlsFootLockGroup::MaxAnimationInstancesCount)
+		{
+			Group = ExistingGroup.Get();
+			break;
+		}
+	}
+
+	if (Group == nullptr)
+	{
+		// Characters, their movement components and skeletal meshes tick in the pre-physics group. The group's tick function
+		// waits for the characters and movement components of its animation instances, and their skeletal meshes wait
+		// for the group's tick function, so the group is always refreshed right before the animation update.
+
+		Group = Groups.Emplace_GetRef(MakeUnique<FAlsFootLockGroup>()).Get();
+
+		Group->TickFunction.Subsystem = this;
+		Group->TickFunction.Group = Group;
+		Group->TickFunction.TickGroup = TG_PrePhysics;
+		Group->TickFunction.bCanEverTick = true;
+		Group->TickFunction.bStartWithTickEnabled = true;
+		Group->TickFunction.RegisterTickFunction(GetWorld()->PersistentLevel);
+	}
+
+	Group->AnimationInstances.Emplace(AnimationInstance);
+
+	Group->TickFunction.AddPrerequisite(Character, Character->PrimaryActorTick);
+
+	if (IsValid(Character->GetCharacterMovement()))
+	{
+		Group->TickFunction.AddPrerequisite(Character->GetCharacterMovement(), Character->GetCharacterMovement()->PrimaryComponentTick);
+	}
+
+	Mesh->PrimaryComponentTick.AddPrerequisite(this, Group->TickFunction);
+}
+
+void UAlsFootLockSubsystem::UnregisterAnimationInstance(UAlsAnimationInstance* AnimationInstance)
+{
+	auto* Group{FindGroup(AnimationInstance)};
+	if (Group == nullptr)
+	{
+		return;
+	}
+
+	Group->AnimationInstances.RemoveSwap(AnimationInstance, EAllowShrinking::No);
+
+	auto* Character{AnimationInstance->Character.Get()};
+	auto* Mesh{AnimationInstance->GetSkelMeshComponent()};
+
+	if (IsValid(Character))
+	{
+		Group->TickFunction.RemovePrerequisite(Character, Character->PrimaryActorTick);
+
+		if (IsValid(Character->GetCharacterMovement()))
+		{
+			Group->TickFunction.RemovePrerequisite(Character->GetCharacterMovement(),
+			                                       Character->GetCharacterMovement()->PrimaryComponentTick);
+		}
+	}
+
+	if (IsValid(Mesh))
+	{
+		Mesh->PrimaryComponentTick.RemovePrerequisite(this, Group->TickFunction);
+	}
+}
+
+FAlsFootLockGroup* UAlsFootLockSubsystem::FindGroup(const UAlsAnimationInstance* AnimationInstance) const
+{
+	for (const auto& Group : Groups)
+	{
+		if (Group->AnimationInstances.Contains(AnimationInstance))
+		{
+			return Group.Get();
+		}
+	}
+
+	return nullptr;
+}
+
+void UAlsFootLockSubsystem::RefreshGroup(FAlsFootLockGroup& Group, const float DeltaTime, const FGraphEventRef& CompletionGraphEvent)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsFootLockSubsystem::RefreshGroup"), STAT_UAlsFootLockSubsystem_RefreshGroup, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
+	GatherGroup(Group, DeltaTime);
+
+	if (Group.BatchAnimationInstances.IsEmpty())
+	{
+		return;
+	}
+
+	// The skeletal meshes of the group wait for the tick function to complete, so they don't
+	// access their animation instances until the task has written the solved feet to them.
+
+	const auto Task{
+		FSimpleDelegateGraphTask::CreateAndDispatchWhenReady(FSimpleDelegate::CreateLambda([&Group]
+		{
+			SolveGroup(Group);
+		}), TStatId{}, nullptr, ENamedThreads::AnyHiPriThreadNormalTask)
+	};
+
+	CompletionGraphEvent->DontCompleteUntil(Task);
+}
+
+void UAlsFootLockSubsystem::GatherGroup(FAlsFootLockGroup& Group, const float DeltaTime)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsFootLockSubsystem::GatherGroup"), STAT_UAlsFootLockSubsystem_GatherGroup, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
+	Group.BatchAnimationInstances.Reset();
+	Group.BatchFootContexts.Reset();
+
+	for (auto i{Group.AnimationInstances.Num() - 1}; i >= 0; i--)
+	{
+		auto* AnimationInstance{Group.AnimationInstances[i].Get()};
+		if (!IsValid(AnimationInstance))
+		{
+			Group.AnimationInstances.RemoveAtSwap(i, EAllowShrinking::No);
+			continue;
+		}
+
+		const auto* Character{AnimationInstance->Character.Get()};
+		const auto* Mesh{AnimationInstance->GetSkelMeshComponent()};
+
+		// Meshes that don't update the animation every frame, and meshes with absolute rotation, which is synchronized
+		// with the character rotation only in the animation instance's own update, refresh the feet by themselves.
+		// Animation instances whose current animation LOD level disables the feet don't refresh them at all.
+
+		if (!IsValid(AnimationInstance->Settings) || !IsValid(Character) || !IsValid(Character->GetSettings()) ||
+		    !IsValid(Mesh) || AnimationInstance->DormancyState.bDormant || AnimationInstance->GetAnimationLodLevel().bDisableFeet ||
+		    Mesh->IsUsingAbsoluteRotation() || !Mesh->PrimaryComponentTick.IsTickFunctionEnabled() ||
+		    Mesh->PrimaryComponentTick.TickInterval > 0.0f || Mesh->ShouldUseUpdateRateOptimizations() ||
+		    Mesh->VisibilityBasedAnimTickOption > EVisibilityBasedAnimTickOption::AlwaysTickPose)
+		{
+			continue;
+		}
+
+		// The curves and the bone transforms are read from the last evaluated pose, so they are the same as they
+		// would be in the animation instance's own update, but the component transform is already up to date here.
+
+		const auto& ComponentTransform{Mesh->GetComponentTransform()};
+
+		AnimationInstance->RefreshCurves();
+		AnimationInstance->RefreshFeetOnGameThread();
+		AnimationInstance->RefreshFeetTargets(ComponentTransform);
+
+		AnimationInstance->FeetBatchRefreshFrame = GFrameCounter;
+
+		if (!AnimationInstance->FeetState.bValid)
+		{
+			continue;
+		}
+
+		// Same delta time that the animation instance will receive in its own update.
+
+		FAlsFootUpdateContext LeftContext;
+		FAlsFootUpdateContext RightContext;
+
+		AnimationInstance->PrepareFeetUpdate(ComponentTransform, DeltaTime * Character->CustomTimeDilation, LeftContext, RightContext);
+
+		// The animation instance refreshes its copies of the movement base and locomotion state only in its own
+		// update, which hasn't happened yet in this frame, so take the current values from the character instead.
+
+		const auto& BasedMovement{Character->GetBasedMovement()};
+		const auto& Locomotion{Character->GetLocomotionState()};
+
+		FVector MovementBaseLocation;
+		FQuat MovementBaseRotation;
+
+		MovementBaseUtility::GetMovementBaseTransform(&BasedMovement.MovementBaseInterfaceData, BasedMovement.BoneName,
+		                                              MovementBaseLocation, MovementBaseRotation);
+
+		const auto bMovementBaseChanged{
+			BasedMovement.MovementBaseInterfaceData != AnimationInstance->MovementBase.MovementBaseInterfaceData ||
+			BasedMovement.BoneName != AnimationInstance->MovementBase.BoneName
+		};
+
+		const auto bMovingSmooth{
+			(Locomotion.bHasInput && Locomotion.bHasVelocity) ||
+			Locomotion.Speed > AnimationInstance->Settings->General.MovingSmoothSpeedThreshold
+		};
+
+		const auto bTeleported{
+			LeftContext.bTeleported || (!AnimationInstance->bPendingUpdate &&
+			                            FVector::DistSquared(AnimationInstance->LocomotionState.LocationWorldSpace,
+			                                                 Character->GetActorLocation()) >
+			                            FMath::Square(Character->GetSettings()->TeleportDistanceThreshold))
+		};
+
+		for (auto* Context : {&LeftContext, &RightContext})
+		{
+			Context->MovementBaseLocation = MovementBaseLocation;
+			Context->MovementBaseRotation = MovementBaseRotation;
+			Context->bTeleported = bTeleported;
+			Context->bMovementBaseChanged = bMovementBaseChanged;
+			Context->bMovementBaseHasRelativeLocation = BasedMovement.HasRelativeLocation();
+			Context->bMovingSmooth = bMovingSmooth;
+			Context->bGrounded = Character->GetLocomotionMode() == AlsLocomotionModeTags::Grounded;
+		}
+
+		Group.BatchAnimationInstances.Emplace(AnimationInstance);
+
+		Group.BatchFootContexts.Emplace(LeftContext);
+		Group.BatchFootContexts.Emplace(RightContext);
+	}
+
+	INC_DWORD_STAT_BY(STAT_Als_FootLockBatchFeet, Group.BatchFootContexts.Num());
+}
+
+void UAlsFootLockSubsystem::SolveGroup(FAlsFootLockGroup& Group)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsFootLockSubsystem::SolveGroup"), STAT_UAlsFootLockSubsystem_SolveGroup, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
+	for (auto i{0}; i < Group.BatchAnimationInstances.Num(); i++)
+	{
+		auto& FeetState{Group.BatchAnimationInstances[i]->FeetState};
+
+		UAlsAnimationInstance::SolveFootLock(FeetState.Left, Group.BatchFootContexts[i * 2]);
+		UAlsAnimationInstance::SolveFootLock(FeetState.Right, Group.BatchFootContexts[i * 2 + 1]);
+	}
+}
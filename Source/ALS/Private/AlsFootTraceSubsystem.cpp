@@ -0,0 +1,155 @@
+#include "AlsFootTraceSubsystem.h"
+
+#include "Engine/World.h"
+#include "Utility/AlsStats.h"
+#include "Utility/AlsUtility.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsFootTraceSubsystem)
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Foot Trace Queries Issued"), STAT_Als_FootTraceQueriesIssued, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Foot Trace Queries Saved"), STAT_Als_FootTraceQueriesSaved, STATGROUP_Als)
+
+void UAlsFootTraceSubsystem::Tick(const float DeltaTime)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsFootTraceSubsystem::Tick"), STAT_UAlsFootTraceSubsystem_Tick, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
+	Super::Tick(DeltaTime);
+
+	static const FName TraceTag{TStringView{FAnsiString::Printf("%s (Foot Trace)", __FUNCTION__)}};
+
+	auto* World{GetWorld()};
+	auto IssuedCount{0};
+
+	FScopeLock SlotsScopeLock{&SlotsLock};
+
+	for (auto i{Slots.Num() - 1}; i >= 0; i--)
+	{
+		const auto Slot{Slots[i].Pin()};
+		if (!Slot.IsValid())
+		{
+			Slots.RemoveAtSwap(i, EAllowShrinking::No);
+			continue;
+		}
+
+		FScopeLock SlotScopeLock{&Slot->Lock};
+
+		// Receive the result of the trace started in the previous frame.
+
+		if (Slot->TraceHandle.IsValid())
+		{
+			FTraceDatum TraceDatum;
+
+			if (World->QueryTraceData(Slot->TraceHandle, TraceDatum))
+			{
+				Slot->TraceHandle.Invalidate();
+
+				Slot->bHasResult = true;
+				Slot->ResultTraceStart = TraceDatum.Start;
+				Slot->ResultTime = World->GetTimeSeconds();
+				Slot->ResultHit = TraceDatum.OutHits.IsEmpty() ? FHitResult{TraceDatum.Start, TraceDatum.End} : TraceDatum.OutHits[0];
+			}
+			else if (!World->IsTraceHandleValid(Slot->TraceHandle, false))
+			{
+				Slot->TraceHandle.Invalidate();
+			}
+		}
+
+		if (!Slot->bRequested || Slot->TraceHandle.IsValid())
+		{
+			continue;
+		}
+
+		Slot->bRequested = false;
+
+		if (Slot->bHasResult && World->GetTimeSeconds() - Slot->ResultTime < ResultRefreshInterval &&
+		    FVector::DistSquared(Slot->RequestedTraceStart, Slot->ResultTraceStart) <= FMath::Square(MaxReuseDistance))
+		{
+			continue;
+		}
+
+		ALS_INC_COUNTER(FootIkSceneQueries);
+		Slot->TraceHandle = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Slot->RequestedTraceStart,
+		                                                   Slot->RequestedTraceEnd, Slot->TraceChannel,
+		                                                   {TraceTag, true, Slot->IgnoredActor.Get()});
+		IssuedCount += 1;
+	}
+
+	// Each request would have been a synchronous trace without the batching, but
+	// requests without a suitable result still had to perform a synchronous trace.
+
+	SET_DWORD_STAT(STAT_Als_FootTraceQueriesIssued, IssuedCount);
+	SET_DWORD_STAT(STAT_Als_FootTraceQueriesSaved, FMath::Max(0, RequestsCount.exchange(0) - FallbacksCount.exchange(0) - IssuedCount));
+}
+
+TStatId UAlsFootTraceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAlsFootTraceSubsystem, STATGROUP_Tickables)
+}
+
+bool UAlsFootTraceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAlsFootTraceSubsystem::RequestTrace(FAlsFootTraceHandle& Handle, const FVector& TraceStart, const FVector& TraceEnd,
+                                          const ECollisionChannel TraceChannel, const AActor* IgnoredActor)
+{
+	if (!Handle.Slot.IsValid())
+	{
+		Handle.Slot = MakeShared<FAlsFootTraceSlot, ESPMode::ThreadSafe>();
+
+		FScopeLock SlotsScopeLock{&SlotsLock};
+		Slots.Emplace(Handle.Slot);
+	}
+
+	RequestsCount += 1;
+
+	FScopeLock SlotScopeLock{&Handle.Slot->Lock};
+
+	Handle.Slot->bRequested = true;
+	Handle.Slot->RequestedTraceStart = TraceStart;
+	Handle.Slot->RequestedTraceEnd = TraceEnd;
+	Handle.Slot->TraceChannel = TraceChannel;
+	Handle.Slot->IgnoredActor = IgnoredActor;
+}
+
+bool UAlsFootTraceSubsystem::GetTraceResult(const FAlsFootTraceHandle& Handle, const bool bReprojectHit, FHitResult& Hit) const
+{
+	if (!Handle.Slot.IsValid())
+	{
+		FallbacksCount += 1;
+		return false;
+	}
+
+	FScopeLock SlotScopeLock{&Handle.Slot->Lock};
+
+	const auto& Slot{*Handle.Slot};
+
+	if (!Slot.bHasResult || FVector::DistSquared(Slot.RequestedTraceStart, Slot.ResultTraceStart) > FMath::Square(MaxReprojectionDistance))
+	{
+		FallbacksCount += 1;
+		return false;
+	}
+
+	Hit = Slot.ResultHit;
+	Hit.TraceStart = Slot.RequestedTraceStart;
+	Hit.TraceEnd = Slot.RequestedTraceEnd;
+
+	if (!bReprojectHit || !Hit.bBlockingHit || Hit.ImpactNormal.Z <= UE_SMALL_NUMBER)
+	{
+		return true;
+	}
+
+	// Move the hit horizontally along with the trace and project it onto the plane of the hit surface.
+
+	const auto Offset{Slot.RequestedTraceStart - Slot.ResultTraceStart};
+	const auto OffsetZ{-(Hit.ImpactNormal.X * Offset.X + Hit.ImpactNormal.Y * Offset.Y) / Hit.ImpactNormal.Z};
+
+	const FVector HitOffset{Offset.X, Offset.Y, OffsetZ};
+
+	Hit.ImpactPoint += HitOffset;
+	Hit.Location += HitOffset;
+
+	return true;
+}
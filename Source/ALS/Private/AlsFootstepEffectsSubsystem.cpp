@@ -0,0 +1,489 @@
+#include "AlsFootstepEffectsSubsystem.h"
+
+#include "NiagaraFunctionLibrary.h"
+#include "Components/AudioComponent.h"
+#include "Components/DecalComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/WorldSettings.h"
+#include "Sound/SoundBase.h"
+#include "Utility/AlsConstants.h"
+#include "Utility/AlsUtility.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsFootstepEffectsSubsystem)
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Footstep Effects Pool Hits"), STAT_Als_FootstepEffectsPoolHits, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Footstep Effects Pool Misses"), STAT_Als_FootstepEffectsPoolMisses, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Footstep Effects Pool Exhausted"), STAT_Als_FootstepEffectsPoolExhausted, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Footstep Effects Culled Requests"), STAT_Als_FootstepEffectsCulledRequests, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Footstep Effects Merged Requests"), STAT_Als_FootstepEffectsMergedRequests, STATGROUP_Als)
+
+void UAlsFootstepEffectsSubsystem::Deinitialize()
+{
+	for (auto& Audio : AudioComponents)
+	{
+		if (IsValid(Audio))
+		{
+			Audio->DestroyComponent();
+		}
+	}
+
+	for (auto& Decal : DecalComponents)
+	{
+		if (IsValid(Decal))
+		{
+			Decal->DestroyComponent();
+		}
+	}
+
+	AudioComponents.Reset();
+	DecalComponents.Reset();
+	DecalComponentsReleaseTimes.Reset();
+	Requests.Reset();
+
+	Super::Deinitialize();
+}
+
+void UAlsFootstepEffectsSubsystem::Tick(const float DeltaTime)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsFootstepEffectsSubsystem::Tick"), STAT_UAlsFootstepEffectsSubsystem_Tick, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
+	Super::Tick(DeltaTime);
+
+	HideReleasedDecalComponents();
+
+	if (Requests.IsEmpty())
+	{
+		return;
+	}
+
+	RefreshViewLocations();
+
+	auto CulledCount{0};
+	auto MergedCount{0};
+
+	for (auto i{Requests.Num() - 1}; i >= 0; i--)
+	{
+		if (CullRequest(Requests[i]))
+		{
+			Requests.RemoveAtSwap(i, EAllowShrinking::No);
+			CulledCount += 1;
+		}
+	}
+
+	// Process the nearest footsteps first so that the distant ones are the first to exceed the budget.
+
+	Requests.Sort([](const FAlsFootstepEffectsRequest& A, const FAlsFootstepEffectsRequest& B)
+	{
+		return A.ViewDistanceSquared < B.ViewDistanceSquared;
+	});
+
+	auto AcceptedCount{0};
+
+	for (auto i{0}; i < Requests.Num(); i++)
+	{
+		if (TryMergeRequest(Requests[i], AcceptedCount))
+		{
+			MergedCount += 1;
+			continue;
+		}
+
+		if (AcceptedCount >= MaxEffectsPerFrame)
+		{
+			CulledCount += 1;
+			continue;
+		}
+
+		if (i != AcceptedCount)
+		{
+			Requests[AcceptedCount] = MoveTemp(Requests[i]);
+		}
+
+		AcceptedCount += 1;
+	}
+
+	for (auto i{0}; i < AcceptedCount; i++)
+	{
+		const auto& Request{Requests[i]};
+
+		const auto* EffectSettings{Request.Settings->FindEffectSettings(Request.SurfaceType)};
+		if (EffectSettings == nullptr)
+		{
+			continue;
+		}
+
+		if (Request.bSpawnSound)
+		{
+			SpawnSound(Request, EffectSettings->Sound);
+		}
+
+		if (Request.bSpawnDecal)
+		{
+			SpawnDecal(Request, EffectSettings->Decal);
+		}
+
+		if (Request.bSpawnParticleSystem)
+		{
+			SpawnParticleSystem(Request, EffectSettings->ParticleSystem);
+		}
+	}
+
+	Requests.Reset();
+
+	INC_DWORD_STAT_BY(STAT_Als_FootstepEffectsCulledRequests, CulledCount);
+	INC_DWORD_STAT_BY(STAT_Als_FootstepEffectsMergedRequests, MergedCount);
+}
+
+TStatId UAlsFootstepEffectsSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAlsFootstepEffectsSubsystem, STATGROUP_Tickables)
+}
+
+bool UAlsFootstepEffectsSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAlsFootstepEffectsSubsystem::AddRequest(const FAlsFootstepEffectsRequest& Request)
+{
+	if (Request.bSpawnSound || Request.bSpawnDecal || Request.bSpawnParticleSystem)
+	{
+		Requests.Emplace(Request);
+	}
+}
+
+void UAlsFootstepEffectsSubsystem::RefreshViewLocations()
+{
+	ViewLocations.Reset();
+
+	for (auto Iterator{GetWorld()->GetPlayerControllerIterator()}; Iterator; ++Iterator)
+	{
+		const auto* PlayerController{Iterator->Get()};
+		if (IsValid(PlayerController) && PlayerController->IsLocalController())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+
+			PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+			ViewLocations.Emplace(ViewLocation);
+		}
+	}
+}
+
+bool UAlsFootstepEffectsSubsystem::CullRequest(FAlsFootstepEffectsRequest& Request) const
+{
+	const auto* Settings{Request.Settings.Get()};
+	if (!IsValid(Settings))
+	{
+		return true;
+	}
+
+	Request.ViewDistanceSquared = ViewLocations.IsEmpty() ? 0.0f : TNumericLimits<FVector::FReal>::Max();
+
+	for (const auto& ViewLocation : ViewLocations)
+	{
+		Request.ViewDistanceSquared = FMath::Min(Request.ViewDistanceSquared, FVector::DistSquared(ViewLocation, Request.Location));
+	}
+
+	if (Settings->CullDistance > 0.0f && Request.ViewDistanceSquared > FMath::Square(Settings->CullDistance))
+	{
+		return true;
+	}
+
+	if (Settings->bCullLowSignificanceVisualEffects && Request.SignificanceTier == EAlsSignificanceTier::Low)
+	{
+		Request.bSpawnDecal = false;
+		Request.bSpawnParticleSystem = false;
+	}
+
+	return !Request.bSpawnSound && !Request.bSpawnDecal && !Request.bSpawnParticleSystem;
+}
+
+bool UAlsFootstepEffectsSubsystem::TryMergeRequest(const FAlsFootstepEffectsRequest& Request, const int32 AcceptedRequestsCount)
+{
+	const auto MergeDistanceSquared{FMath::Square(Request.Settings->MergeDistance)};
+
+	for (auto i{0}; i < AcceptedRequestsCount; i++)
+	{
+		auto& AcceptedRequest{Requests[i]};
+
+		if (AcceptedRequest.Settings != Request.Settings || AcceptedRequest.SurfaceType != Request.SurfaceType ||
+		    FVector::DistSquared(AcceptedRequest.Location, Request.Location) > MergeDistanceSquared)
+		{
+			continue;
+		}
+
+		// Only the sound is merged, as the decal and particle system of the accepted footstep already cover this one.
+
+		if (!Request.bSpawnSound)
+		{
+			return true;
+		}
+
+		if (!AcceptedRequest.bSpawnSound)
+		{
+			AcceptedRequest.bSpawnSound = true;
+			AcceptedRequest.SoundType = Request.SoundType;
+			AcceptedRequest.SoundVolumeMultiplier = Request.SoundVolumeMultiplier;
+			AcceptedRequest.SoundPitchMultiplier = Request.SoundPitchMultiplier;
+		}
+		else
+		{
+			AcceptedRequest.SoundVolumeMultiplier = FMath::Max(AcceptedRequest.SoundVolumeMultiplier, Request.SoundVolumeMultiplier);
+		}
+
+		return true;
+	}
+
+	return false;
+}
+
+void UAlsFootstepEffectsSubsystem::SpawnSound(const FAlsFootstepEffectsRequest& Request, const FAlsFootstepSoundSettings& SoundSettings)
+{
+	if (!IsValid(SoundSettings.Sound.LoadSynchronous()))
+	{
+		return;
+	}
+
+	auto* Mesh{Request.Mesh.Get()};
+
+	if (SoundSettings.SpawnMode == EAlsFootstepSoundSpawnMode::SpawnAttachedToFootBone && !IsValid(Mesh))
+	{
+		return;
+	}
+
+	auto* Audio{AcquireAudioComponent()};
+	if (!IsValid(Audio))
+	{
+		return;
+	}
+
+	if (SoundSettings.SpawnMode == EAlsFootstepSoundSpawnMode::SpawnAttachedToFootBone)
+	{
+		const auto& FootBoneName{
+			Request.FootBone == EAlsFootBone::Left ? UAlsConstants::FootLeftBoneName() : UAlsConstants::FootRightBoneName()
+		};
+
+		Audio->AttachToComponent(Mesh, FAttachmentTransformRules::SnapToTargetNotIncludingScale, FootBoneName);
+	}
+	else
+	{
+		Audio->SetWorldLocationAndRotation(Request.Location, Request.Rotation);
+	}
+
+	Audio->SetSound(SoundSettings.Sound.Get());
+	Audio->SetVolumeMultiplier(Request.SoundVolumeMultiplier);
+	Audio->SetPitchMultiplier(Request.SoundPitchMultiplier);
+	Audio->SetIntParameter(FName{ANSITEXTVIEW("FootstepType")}, static_cast<int32>(Request.SoundType));
+	Audio->Play();
+}
+
+void UAlsFootstepEffectsSubsystem::SpawnDecal(const FAlsFootstepEffectsRequest& Request, const FAlsFootstepDecalSettings& DecalSettings)
+{
+	if (!IsValid(DecalSettings.DecalMaterial.LoadSynchronous()))
+	{
+		return;
+	}
+
+	auto* Decal{AcquireDecalComponent(GetWorld()->GetTimeSeconds() + DecalSettings.Duration + DecalSettings.FadeOutDuration)};
+	if (!IsValid(Decal))
+	{
+		return;
+	}
+
+	const auto DecalRotation{
+		Request.Rotation * FQuat{
+			Request.FootBone == EAlsFootBone::Left
+				? DecalSettings.FootLeftRotationOffsetQuaternion
+				: DecalSettings.FootRightRotationOffsetQuaternion
+		}
+	};
+
+	const auto DecalLocation{
+		Request.Location + DecalRotation.RotateVector(FVector{DecalSettings.LocationOffset} * Request.MeshScale)
+	};
+
+	Decal->SetDecalMaterial(DecalSettings.DecalMaterial.Get());
+	Decal->DecalSize = FVector{DecalSettings.Size} * Request.MeshScale;
+	Decal->SetWorldLocationAndRotation(DecalLocation, DecalRotation);
+
+	if (DecalSettings.SpawnMode == EAlsFootstepDecalSpawnMode::SpawnAttachedToTraceHitComponent && Request.HitComponent.IsValid())
+	{
+		Decal->AttachToComponent(Request.HitComponent.Get(), FAttachmentTransformRules::KeepWorldTransform);
+	}
+
+	// The fade out also sets the life span of the decal component, after which it would be destroyed, so clear the life span
+	// right away to keep the component in the pool. The component is hidden instead once the fade out is finished.
+
+	Decal->SetFadeOut(DecalSettings.Duration, DecalSettings.FadeOutDuration, false);
+	Decal->SetLifeSpan(0.0f);
+
+	Decal->SetVisibility(true);
+
+	// Recreate the render state to apply the new size and restart the fade out.
+
+	Decal->MarkRenderStateDirty();
+}
+
+void UAlsFootstepEffectsSubsystem::SpawnParticleSystem(const FAlsFootstepEffectsRequest& Request,
+                                                       const FAlsFootstepParticleSystemSettings& ParticleSystemSettings) const
+{
+	if (!IsValid(ParticleSystemSettings.ParticleSystem.LoadSynchronous()))
+	{
+		return;
+	}
+
+	if (ParticleSystemSettings.SpawnMode == EAlsFootstepParticleEffectSpawnMode::SpawnAtTraceHitLocation)
+	{
+		const auto ParticleSystemRotation{
+			Request.Rotation * FQuat{
+				Request.FootBone == EAlsFootBone::Left
+					? ParticleSystemSettings.FootLeftRotationOffsetQuaternion
+					: ParticleSystemSettings.FootRightRotationOffsetQuaternion
+			}
+		};
+
+		const auto ParticleSystemLocation{
+			Request.Location +
+			ParticleSystemRotation.RotateVector(FVector{ParticleSystemSettings.LocationOffset} * Request.MeshScale)
+		};
+
+		UNiagaraFunctionLibrary::SpawnSystemAtLocation(GetWorld(), ParticleSystemSettings.ParticleSystem.Get(),
+		                                               ParticleSystemLocation, ParticleSystemRotation.Rotator(),
+		                                               FVector::OneVector * Request.MeshScale, true, true, ENCPoolMethod::AutoRelease);
+	}
+	else if (ParticleSystemSettings.SpawnMode == EAlsFootstepParticleEffectSpawnMode::SpawnAttachedToFootBone && Request.Mesh.IsValid())
+	{
+		const auto& FootBoneName{
+			Request.FootBone == EAlsFootBone::Left ? UAlsConstants::FootLeftBoneName() : UAlsConstants::FootRightBoneName()
+		};
+
+		UNiagaraFunctionLibrary::SpawnSystemAttached(ParticleSystemSettings.ParticleSystem.Get(), Request.Mesh.Get(), FootBoneName,
+		                                             FVector{ParticleSystemSettings.LocationOffset} * Request.MeshScale,
+		                                             FRotator{
+			                                             Request.FootBone == EAlsFootBone::Left
+				                                             ? ParticleSystemSettings.FootLeftRotationOffset
+				                                             : ParticleSystemSettings.FootRightRotationOffset
+		                                             },
+		                                             FVector::OneVector * Request.MeshScale, EAttachLocation::KeepRelativeOffset,
+		                                             true, ENCPoolMethod::AutoRelease);
+	}
+}
+
+UAudioComponent* UAlsFootstepEffectsSubsystem::AcquireAudioComponent()
+{
+	for (auto i{AudioComponents.Num() - 1}; i >= 0; i--)
+	{
+		auto* Audio{AudioComponents[i].Get()};
+		if (!IsValid(Audio))
+		{
+			AudioComponents.RemoveAtSwap(i, EAllowShrinking::No);
+			continue;
+		}
+
+		if (!Audio->IsPlaying())
+		{
+			INC_DWORD_STAT(STAT_Als_FootstepEffectsPoolHits);
+
+			Audio->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+			return Audio;
+		}
+	}
+
+	if (AudioComponents.Num() >= MaxAudioComponents)
+	{
+		INC_DWORD_STAT(STAT_Als_FootstepEffectsPoolExhausted);
+		return nullptr;
+	}
+
+	INC_DWORD_STAT(STAT_Als_FootstepEffectsPoolMisses);
+
+	auto* World{GetWorld()};
+
+	auto* Audio{NewObject<UAudioComponent>(World->GetWorldSettings(), NAME_None, RF_Transient)};
+	Audio->bAutoActivate = false;
+	Audio->bAutoDestroy = false;
+	Audio->bAllowAnyoneToDestroyMe = true;
+	Audio->RegisterComponentWithWorld(World);
+
+	AudioComponents.Emplace(Audio);
+	return Audio;
+}
+
+void UAlsFootstepEffectsSubsystem::HideReleasedDecalComponents()
+{
+	const auto WorldTime{GetWorld()->GetTimeSeconds()};
+
+	for (auto i{0}; i < DecalComponents.Num(); i++)
+	{
+		auto* Decal{DecalComponents[i].Get()};
+
+		if (WorldTime >= DecalComponentsReleaseTimes[i] && IsValid(Decal) && Decal->IsVisible())
+		{
+			Decal->SetVisibility(false);
+		}
+	}
+}
+
+UDecalComponent* UAlsFootstepEffectsSubsystem::AcquireDecalComponent(const double ReleaseTime)
+{
+	auto* World{GetWorld()};
+	const auto WorldTime{World->GetTimeSeconds()};
+
+	for (auto i{DecalComponents.Num() - 1}; i >= 0; i--)
+	{
+		auto* Decal{DecalComponents[i].Get()};
+		if (!IsValid(Decal))
+		{
+			DecalComponents.RemoveAtSwap(i, EAllowShrinking::No);
+			DecalComponentsReleaseTimes.RemoveAtSwap(i, EAllowShrinking::No);
+			continue;
+		}
+
+		if (WorldTime >= DecalComponentsReleaseTimes[i])
+		{
+			INC_DWORD_STAT(STAT_Als_FootstepEffectsPoolHits);
+
+			DecalComponentsReleaseTimes[i] = ReleaseTime;
+
+			Decal->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+			return Decal;
+		}
+	}
+
+	if (DecalComponents.Num() >= MaxDecalComponents)
+	{
+		INC_DWORD_STAT(STAT_Als_FootstepEffectsPoolExhausted);
+
+		// Reuse the decal component that is the closest to being released, since its decal has faded out the most.
+
+		auto OldestIndex{0};
+
+		for (auto i{1}; i < DecalComponentsReleaseTimes.Num(); i++)
+		{
+			if (DecalComponentsReleaseTimes[i] < DecalComponentsReleaseTimes[OldestIndex])
+			{
+				OldestIndex = i;
+			}
+		}
+
+		DecalComponentsReleaseTimes[OldestIndex] = ReleaseTime;
+
+		auto* Decal{DecalComponents[OldestIndex].Get()};
+		Decal->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+		return Decal;
+	}
+
+	INC_DWORD_STAT(STAT_Als_FootstepEffectsPoolMisses);
+
+	auto* Decal{NewObject<UDecalComponent>(World->GetWorldSettings(), NAME_None, RF_Transient)};
+	Decal->bAllowAnyoneToDestroyMe = true;
+	Decal->RegisterComponentWithWorld(World);
+
+	DecalComponents.Emplace(Decal);
+	DecalComponentsReleaseTimes.Emplace(ReleaseTime);
+	return Decal;
+}
@@ -0,0 +1,456 @@
+#include "AlsLedgeIndexSubsystem.h"
+
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "Utility/AlsUtility.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsLedgeIndexSubsystem)
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ledge Index Ledges"), STAT_Als_LedgeIndexLedges, STATGROUP_Als)
+
+void UAlsLedgeIndexSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	FWorldDelegates::LevelAddedToWorld.AddUObject(this, &ThisClass::OnLevelAddedToWorld);
+	FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &ThisClass::OnLevelRemovedFromWorld);
+}
+
+void UAlsLedgeIndexSubsystem::OnWorldBeginPlay(UWorld& World)
+{
+	Super::OnWorldBeginPlay(World);
+
+	// Build the index while the level is loading rather than on the first mantling attempt to avoid a hitch during gameplay.
+
+	BuildIndex();
+}
+
+void UAlsLedgeIndexSubsystem::Deinitialize()
+{
+	FWorldDelegates::LevelAddedToWorld.RemoveAll(this);
+	FWorldDelegates::LevelRemovedFromWorld.RemoveAll(this);
+
+	Ledges.Empty();
+	Cells.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UAlsLedgeIndexSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+bool UAlsLedgeIndexSubsystem::FindLedge(const FAlsLedgeQuery& Query, const FAlsLedge*& Ledge, FVector& LedgeLocation)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsLedgeIndexSubsystem::FindLedge"), STAT_UAlsLedgeIndexSubsystem_FindLedge, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
+	Ledge = nullptr;
+
+	if (!bIndexBuilt)
+	{
+		return false;
+	}
+
+	const FVector2D Origin{Query.Location};
+	const FVector2D Direction{Query.Direction};
+	const auto End{Origin + Direction * Query.MaxDistance};
+
+	const auto MinCellX{FMath::FloorToInt32((FMath::Min(Origin.X, End.X) - Query.HalfWidth) / CellSize)};
+	const auto MinCellY{FMath::FloorToInt32((FMath::Min(Origin.Y, End.Y) - Query.HalfWidth) / CellSize)};
+	const auto MaxCellX{FMath::FloorToInt32((FMath::Max(Origin.X, End.X) + Query.HalfWidth) / CellSize)};
+	const auto MaxCellY{FMath::FloorToInt32((FMath::Max(Origin.Y, End.Y) + Query.HalfWidth) / CellSize)};
+
+	auto MinDistance{TNumericLimits<FVector::FReal>::Max()};
+
+	for (auto CellX{MinCellX}; CellX <= MaxCellX; CellX++)
+	{
+		for (auto CellY{MinCellY}; CellY <= MaxCellY; CellY++)
+		{
+			const auto* CellLedges{Cells.Find({CellX, CellY})};
+			if (CellLedges == nullptr)
+			{
+				continue;
+			}
+
+			for (const auto LedgeIndex : *CellLedges)
+			{
+				const auto& Candidate{Ledges[LedgeIndex]};
+
+				if ((Candidate.Direction | Query.Direction) >= 0.0f ||
+				    Candidate.TopNormal.Z < Query.MinTopNormalZ || Candidate.SideNormalZ > Query.MaxSideNormalZ)
+				{
+					continue;
+				}
+
+				// The lateral offset from the query line changes linearly along the ledge,
+				// so find the part of the ledge that lies within the query half width.
+
+				const FVector2D CandidateStart{Candidate.Start};
+				const auto CandidateSegment{FVector2D{Candidate.End} - CandidateStart};
+
+				const auto StartOffset{Direction ^ (CandidateStart - Origin)};
+				const auto OffsetDelta{Direction ^ CandidateSegment};
+
+				double Time;
+
+				if (FMath::IsNearlyZero(OffsetDelta))
+				{
+					if (FMath::Abs(StartOffset) > Query.HalfWidth)
+					{
+						continue;
+					}
+
+					Time = 0.5;
+				}
+				else
+				{
+					const auto Time1{(-Query.HalfWidth - StartOffset) / OffsetDelta};
+					const auto Time2{(Query.HalfWidth - StartOffset) / OffsetDelta};
+
+					const auto MinTime{FMath::Max(0.0, FMath::Min(Time1, Time2))};
+					const auto MaxTime{FMath::Min(1.0, FMath::Max(Time1, Time2))};
+
+					if (MinTime > MaxTime)
+					{
+						continue;
+					}
+
+					// Prefer the point directly in front of the query location.
+
+					Time = FMath::Clamp(-StartOffset / OffsetDelta, MinTime, MaxTime);
+				}
+
+				const auto Location{FMath::Lerp(Candidate.Start, Candidate.End, Time)};
+
+				const auto Distance{(FVector2D{Location} - Origin) | Direction};
+				const auto Height{Location.Z - Query.Location.Z};
+
+				if (Distance <= 0.0f || Distance > Query.MaxDistance || Distance >= MinDistance ||
+				    Height < Query.MinHeight || Height > Query.MaxHeight)
+				{
+					continue;
+				}
+
+				const auto* Primitive{Candidate.Primitive.Get()};
+
+				if (!IsValid(Primitive) ||
+				    FMath::Min(Primitive->GetCollisionResponseToChannel(Query.TraceChannel),
+				               Query.TraceResponses.GetResponse(Primitive->GetCollisionObjectType())) != ECR_Block)
+				{
+					continue;
+				}
+
+				MinDistance = Distance;
+
+				Ledge = &Candidate;
+				LedgeLocation = Location;
+			}
+		}
+	}
+
+	return Ledge != nullptr;
+}
+
+void UAlsLedgeIndexSubsystem::AddPrimitive(UPrimitiveComponent* Primitive)
+{
+	if (bIndexBuilt && IsValid(Primitive) && Primitive->GetWorld() == GetWorld())
+	{
+		IndexPrimitive(Primitive, Primitive->GetComponentLevel());
+
+		SET_DWORD_STAT(STAT_Als_LedgeIndexLedges, Ledges.Num());
+	}
+}
+
+void UAlsLedgeIndexSubsystem::RemovePrimitive(const UPrimitiveComponent* Primitive)
+{
+	if (Ledges.RemoveAll([Primitive](const FAlsLedge& Ledge) { return Ledge.Primitive == Primitive; }) > 0)
+	{
+		RebuildCells();
+
+		SET_DWORD_STAT(STAT_Als_LedgeIndexLedges, Ledges.Num());
+	}
+}
+
+void UAlsLedgeIndexSubsystem::OnLevelAddedToWorld(ULevel* Level, UWorld* World)
+{
+	if (bIndexBuilt && World == GetWorld() && IsValid(Level))
+	{
+		IndexLevel(Level);
+	}
+}
+
+void UAlsLedgeIndexSubsystem::OnLevelRemovedFromWorld(ULevel* Level, UWorld* World)
+{
+	if (!bIndexBuilt || World != GetWorld())
+	{
+		return;
+	}
+
+	if (Level == nullptr)
+	{
+		// All levels have been removed.
+
+		Ledges.Reset();
+		Cells.Reset();
+
+		SET_DWORD_STAT(STAT_Als_LedgeIndexLedges, 0);
+		return;
+	}
+
+	const TObjectKey<ULevel> LevelKey{Level};
+
+	if (Ledges.RemoveAll([&LevelKey](const FAlsLedge& Ledge) { return Ledge.Level == LevelKey; }) > 0)
+	{
+		RebuildCells();
+	}
+
+	SET_DWORD_STAT(STAT_Als_LedgeIndexLedges, Ledges.Num());
+}
+
+void UAlsLedgeIndexSubsystem::BuildIndex()
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsLedgeIndexSubsystem::BuildIndex"), STAT_UAlsLedgeIndexSubsystem_BuildIndex, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
+	bIndexBuilt = true;
+
+	Ledges.Reset();
+	Cells.Reset();
+
+	for (auto* Level : GetWorld()->GetLevels())
+	{
+		if (IsValid(Level) && Level->bIsVisible)
+		{
+			IndexLevel(Level);
+		}
+	}
+}
+
+void UAlsLedgeIndexSubsystem::IndexLevel(ULevel* Level)
+{
+	for (const auto& Actor : Level->Actors)
+	{
+		if (IsValid(Actor))
+		{
+			Actor->ForEachComponent<UPrimitiveComponent>(false, [this, Level](UPrimitiveComponent* Primitive)
+			{
+				IndexPrimitive(Primitive, Level);
+			});
+		}
+	}
+
+	SET_DWORD_STAT(STAT_Als_LedgeIndexLedges, Ledges.Num());
+}
+
+void UAlsLedgeIndexSubsystem::IndexPrimitive(UPrimitiveComponent* Primitive, const ULevel* Level)
+{
+	// Instances of instanced static meshes share the body setup of the component, and have
+	// their own transforms, which is not supported, so such components are not indexed.
+
+	if (Primitive->Mobility != EComponentMobility::Static || !Primitive->IsQueryCollisionEnabled() ||
+	    Primitive->IsA<UInstancedStaticMeshComponent>())
+	{
+		return;
+	}
+
+	const auto* BodySetup{Primitive->GetBodySetup()};
+	if (!IsValid(BodySetup))
+	{
+		return;
+	}
+
+	const auto& ComponentTransform{Primitive->GetComponentTransform()};
+
+	static constexpr int32 BoxIndices[]{
+		0, 2, 6, 0, 6, 4, // -X
+		1, 3, 7, 1, 7, 5, // +X
+		0, 1, 5, 0, 5, 4, // -Y
+		2, 3, 7, 2, 7, 6, // +Y
+		0, 1, 3, 0, 3, 2, // -Z
+		4, 5, 7, 4, 7, 6 // +Z
+	};
+
+	TArray<FVector, TInlineAllocator<8>> BoxVertices;
+
+	for (const auto& Box : BodySetup->AggGeom.BoxElems)
+	{
+		const auto BoxTransform{Box.GetTransform() * ComponentTransform};
+
+		BoxVertices.Reset();
+
+		for (auto i{0}; i < 8; i++)
+		{
+			BoxVertices.Emplace(BoxTransform.TransformPosition({
+				(i & 1 ? 0.5f : -0.5f) * Box.X,
+				(i & 2 ? 0.5f : -0.5f) * Box.Y,
+				(i & 4 ? 0.5f : -0.5f) * Box.Z
+			}));
+		}
+
+		IndexConvex(BoxVertices, BoxIndices, Primitive, Level);
+	}
+
+	TArray<FVector> ConvexVertices;
+
+	for (const auto& Convex : BodySetup->AggGeom.ConvexElems)
+	{
+		const auto ConvexTransform{Convex.GetTransform() * ComponentTransform};
+
+		ConvexVertices.Reset(Convex.VertexData.Num());
+
+		for (const auto& Vertex : Convex.VertexData)
+		{
+			ConvexVertices.Emplace(ConvexTransform.TransformPosition(Vertex));
+		}
+
+		IndexConvex(ConvexVertices, Convex.IndexData, Primitive, Level);
+	}
+}
+
+void UAlsLedgeIndexSubsystem::IndexConvex(const TConstArrayView<FVector> Vertices, const TConstArrayView<int32> Indices,
+                                          UPrimitiveComponent* Primitive, const ULevel* Level)
+{
+	if (Vertices.IsEmpty())
+	{
+		return;
+	}
+
+	// Edges between nearly coplanar triangles, such as the diagonals of a box face, are not ledges.
+
+	static constexpr auto MaxLedgeTriangleNormalsDot{0.9f};
+
+	auto Centroid{FVector::ZeroVector};
+
+	for (const auto& Vertex : Vertices)
+	{
+		Centroid += Vertex;
+	}
+
+	Centroid /= Vertices.Num();
+
+	// Maps each edge to the normal of the first triangle that contains it.
+
+	TMap<FIntPoint, FVector> EdgeNormals;
+
+	for (auto i{0}; i + 2 < Indices.Num(); i += 3)
+	{
+		const int32 TriangleIndices[]{Indices[i], Indices[i + 1], Indices[i + 2]};
+
+		if (!Vertices.IsValidIndex(TriangleIndices[0]) || !Vertices.IsValidIndex(TriangleIndices[1]) ||
+		    !Vertices.IsValidIndex(TriangleIndices[2]))
+		{
+			continue;
+		}
+
+		const auto& A{Vertices[TriangleIndices[0]]};
+		const auto& B{Vertices[TriangleIndices[1]]};
+		const auto& C{Vertices[TriangleIndices[2]]};
+
+		auto Normal{((B - A) ^ (C - A)).GetSafeNormal()};
+		if (Normal.IsZero())
+		{
+			continue;
+		}
+
+		// The winding order is not guaranteed, so make the normal point away from the center of the convex.
+
+		if ((Normal | ((A + B + C) / 3.0f - Centroid)) < 0.0f)
+		{
+			Normal = -Normal;
+		}
+
+		for (auto j{0}; j < 3; j++)
+		{
+			const auto EdgeStartIndex{TriangleIndices[j]};
+			const auto EdgeEndIndex{TriangleIndices[(j + 1) % 3]};
+
+			const FIntPoint Edge{FMath::Min(EdgeStartIndex, EdgeEndIndex), FMath::Max(EdgeStartIndex, EdgeEndIndex)};
+
+			const auto* OtherNormal{EdgeNormals.Find(Edge)};
+			if (OtherNormal == nullptr)
+			{
+				EdgeNormals.Emplace(Edge, Normal);
+				continue;
+			}
+
+			const auto& TopNormal{Normal.Z >= OtherNormal->Z ? Normal : *OtherNormal};
+			const auto& SideNormal{Normal.Z >= OtherNormal->Z ? *OtherNormal : Normal};
+
+			if (TopNormal.Z <= 0.0f || (TopNormal | SideNormal) > MaxLedgeTriangleNormalsDot)
+			{
+				continue;
+			}
+
+			const auto Direction{SideNormal.GetSafeNormal2D()};
+			if (Direction.IsZero())
+			{
+				continue;
+			}
+
+			auto& Ledge{Ledges.Emplace_GetRef()};
+
+			Ledge.Start = Vertices[EdgeStartIndex];
+			Ledge.End = Vertices[EdgeEndIndex];
+			Ledge.TopNormal = TopNormal;
+			Ledge.Direction = Direction;
+			Ledge.SideNormalZ = UE_REAL_TO_FLOAT(SideNormal.Z);
+			Ledge.Primitive = Primitive;
+			Ledge.Level = Level;
+
+			AddLedgeToCells(Ledges.Num() - 1);
+		}
+	}
+}
+
+void UAlsLedgeIndexSubsystem::AddLedgeToCells(const int32 LedgeIndex)
+{
+	const auto& Ledge{Ledges[LedgeIndex]};
+
+	const FVector2D Start{Ledge.Start};
+	const FVector2D End{Ledge.End};
+
+	// Walk along the ledge in steps no longer than half a cell and add the ledge to all cells touched by
+	// the bounding box of each step. This is conservative, but avoids adding long diagonal ledges to
+	// every cell of their bounding box.
+
+	const auto StepsCount{FMath::Max(1, FMath::CeilToInt32(FVector2D::Distance(Start, End) / (CellSize * 0.5f)))};
+
+	for (auto i{0}; i < StepsCount; i++)
+	{
+		const auto StepStart{FMath::Lerp(Start, End, static_cast<double>(i) / StepsCount)};
+		const auto StepEnd{FMath::Lerp(Start, End, static_cast<double>(i + 1) / StepsCount)};
+
+		const auto MinCellX{FMath::FloorToInt32(FMath::Min(StepStart.X, StepEnd.X) / CellSize)};
+		const auto MinCellY{FMath::FloorToInt32(FMath::Min(StepStart.Y, StepEnd.Y) / CellSize)};
+		const auto MaxCellX{FMath::FloorToInt32(FMath::Max(StepStart.X, StepEnd.X) / CellSize)};
+		const auto MaxCellY{FMath::FloorToInt32(FMath::Max(StepStart.Y, StepEnd.Y) / CellSize)};
+
+		for (auto CellX{MinCellX}; CellX <= MaxCellX; CellX++)
+		{
+			for (auto CellY{MinCellY}; CellY <= MaxCellY; CellY++)
+			{
+				auto& CellLedges{Cells.FindOrAdd({CellX, CellY})};
+
+				if (CellLedges.IsEmpty() || CellLedges.Last() != LedgeIndex)
+				{
+					CellLedges.Emplace(LedgeIndex);
+				}
+			}
+		}
+	}
+}
+
+void UAlsLedgeIndexSubsystem::RebuildCells()
+{
+	Cells.Reset();
+
+	for (auto i{0}; i < Ledges.Num(); i++)
+	{
+		AddLedgeToCells(i);
+	}
+}
@@ -0,0 +1,199 @@
+#include "AlsSignificanceSubsystem.h"
+
+#include "AlsCharacter.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Settings/AlsCharacterSettings.h"
+#include "Utility/AlsMacros.h"
+#include "Utility/AlsUtility.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsSignificanceSubsystem)
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Significance High Tier Characters"), STAT_Als_SignificanceHighTierCharacters, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Significance Medium Tier Characters"), STAT_Als_SignificanceMediumTierCharacters, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Significance Low Tier Characters"), STAT_Als_SignificanceLowTierCharacters, STATGROUP_Als)
+
+DECLARE_CYCLE_STAT(TEXT("AAlsCharacter::Tick (High Tier)"), STAT_AAlsCharacter_Tick_HighTier, STATGROUP_Als)
+DECLARE_CYCLE_STAT(TEXT("AAlsCharacter::Tick (Medium Tier)"), STAT_AAlsCharacter_Tick_MediumTier, STATGROUP_Als)
+DECLARE_CYCLE_STAT(TEXT("AAlsCharacter::Tick (Low Tier)"), STAT_AAlsCharacter_Tick_LowTier, STATGROUP_Als)
+
+void UAlsSignificanceSubsystem::Tick(const float DeltaTime)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsSignificanceSubsystem::Tick"), STAT_UAlsSignificanceSubsystem_Tick, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
+	Super::Tick(DeltaTime);
+
+	RefreshViewLocations();
+
+	auto HighTierCount{0};
+	auto MediumTierCount{0};
+	auto LowTierCount{0};
+
+	for (auto i{Characters.Num() - 1}; i >= 0; i--)
+	{
+		auto* Character{Characters[i].Get()};
+		if (!IsValid(Character))
+		{
+			Characters.RemoveAtSwap(i, EAllowShrinking::No);
+			continue;
+		}
+
+		const auto ViewerDistance{CalculateViewerDistance(Character)};
+		const auto Tier{CalculateTier(Character, ViewerDistance)};
+
+		Character->SetSignificance(Tier, ViewerDistance);
+
+		switch (Tier)
+		{
+			case EAlsSignificanceTier::High:
+				HighTierCount += 1;
+				break;
+
+			case EAlsSignificanceTier::Medium:
+				MediumTierCount += 1;
+				break;
+
+			case EAlsSignificanceTier::Low:
+				LowTierCount += 1;
+				break;
+		}
+	}
+
+	SET_DWORD_STAT(STAT_Als_SignificanceHighTierCharacters, HighTierCount);
+	SET_DWORD_STAT(STAT_Als_SignificanceMediumTierCharacters, MediumTierCount);
+	SET_DWORD_STAT(STAT_Als_SignificanceLowTierCharacters, LowTierCount);
+}
+
+TStatId UAlsSignificanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAlsSignificanceSubsystem, STATGROUP_Tickables)
+}
+
+bool UAlsSignificanceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAlsSignificanceSubsystem::RegisterCharacter(AAlsCharacter* Character)
+{
+	if (ALS_ENSURE(IsValid(Character)))
+	{
+		Characters.AddUnique(Character);
+	}
+}
+
+void UAlsSignificanceSubsystem::UnregisterCharacter(AAlsCharacter* Character)
+{
+	Characters.RemoveSwap(Character, EAllowShrinking::No);
+}
+
+TStatId UAlsSignificanceSubsystem::GetTierTickStatId(const EAlsSignificanceTier Tier)
+{
+	switch (Tier)
+	{
+		case EAlsSignificanceTier::Medium:
+			return GET_STATID(STAT_AAlsCharacter_Tick_MediumTier);
+
+		case EAlsSignificanceTier::Low:
+			return GET_STATID(STAT_AAlsCharacter_Tick_LowTier);
+
+		default:
+			return GET_STATID(STAT_AAlsCharacter_Tick_HighTier);
+	}
+}
+
+void UAlsSignificanceSubsystem::RefreshViewLocations()
+{
+	ViewLocations.Reset();
+	ViewPawns.Reset();
+
+	// On the server, this also includes player controllers of remote clients, so the
+	// significance is calculated relative to what each connected player can see.
+
+	for (auto Iterator{GetWorld()->GetPlayerControllerIterator()}; Iterator; ++Iterator)
+	{
+		const auto* PlayerController{Iterator->Get()};
+		if (IsValid(PlayerController))
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+
+			PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+			ViewLocations.Emplace(ViewLocation);
+			ViewPawns.Emplace(PlayerController->GetPawn());
+		}
+	}
+}
+
+float UAlsSignificanceSubsystem::CalculateViewerDistance(const AAlsCharacter* Character) const
+{
+	// The character's own view location is skipped, since the owning player doesn't receive most of
+	// the character's replicated properties and always sees the character in full detail anyway.
+
+	const auto CharacterLocation{Character->GetActorLocation()};
+
+	auto DistanceSquared{TNumericLimits<FVector::FReal>::Max()};
+
+	for (auto i{0}; i < ViewLocations.Num(); i++)
+	{
+		if (ViewPawns[i] != Character)
+		{
+			DistanceSquared = FMath::Min(DistanceSquared, FVector::DistSquared(ViewLocations[i], CharacterLocation));
+		}
+	}
+
+	return UE_REAL_TO_FLOAT(FMath::Min(FMath::Sqrt(DistanceSquared), static_cast<FVector::FReal>(TNumericLimits<float>::Max())));
+}
+
+EAlsSignificanceTier UAlsSignificanceSubsystem::CalculateTier(const AAlsCharacter* Character, const float ViewerDistance) const
+{
+	const auto* CharacterSettings{Character->GetSettings()};
+
+	if (!IsValid(CharacterSettings) || !CharacterSettings->Significance.bAllowTickThrottling ||
+	    Character->IsLocallyControlled() || Character->GetRemoteRole() == ROLE_AutonomousProxy ||
+	    Character->GetLocomotionAction().IsValid())
+	{
+		return EAlsSignificanceTier::High;
+	}
+
+	const auto& Settings{CharacterSettings->Significance};
+
+	// Offset the tier distances away from the current tier to make it harder to leave it.
+
+	const auto CurrentTier{Character->GetSignificanceState().Tier};
+
+	const auto MediumTierDistance{
+		FMath::Max(0.0f, Settings.MediumTierDistance + (CurrentTier >= EAlsSignificanceTier::Medium
+			                                                ? -Settings.TierDistanceHysteresis
+			                                                : Settings.TierDistanceHysteresis))
+	};
+
+	const auto LowTierDistance{
+		FMath::Max(0.0f, Settings.LowTierDistance + (CurrentTier >= EAlsSignificanceTier::Low
+			                                             ? -Settings.TierDistanceHysteresis
+			                                             : Settings.TierDistanceHysteresis))
+	};
+
+	auto Tier{EAlsSignificanceTier::High};
+
+	if (ViewerDistance > LowTierDistance)
+	{
+		Tier = EAlsSignificanceTier::Low;
+	}
+	else if (ViewerDistance > MediumTierDistance)
+	{
+		Tier = EAlsSignificanceTier::Medium;
+	}
+
+	if (Tier != EAlsSignificanceTier::Low && Settings.bLowerTierWhenNotRendered &&
+	    !GetWorld()->IsNetMode(NM_DedicatedServer) && IsValid(Character->GetMesh()) &&
+	    !Character->GetMesh()->WasRecentlyRendered())
+	{
+		Tier = Tier == EAlsSignificanceTier::High ? EAlsSignificanceTier::Medium : EAlsSignificanceTier::Low;
+	}
+
+	return Tier;
+}
@@ -0,0 +1,221 @@
+#include "AlsStateBatchSubsystem.h"
+
+#include "AlsAnimationInstance.h"
+#include "AlsCharacter.h"
+#include "Async/ParallelFor.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "GameFramework/Controller.h"
+#include "Utility/AlsMacros.h"
+#include "Utility/AlsUtility.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsStateBatchSubsystem)
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("State Batch Characters"), STAT_Als_StateBatchCharacters, STATGROUP_Als)
+
+void FAlsStateBatchTickFunction::ExecuteTick(const float DeltaTime, const ELevelTick TickType, ENamedThreads::Type CurrentThread,
+                                             const FGraphEventRef& CompletionGraphEvent)
+{
+	if (TickType != LEVELTICK_ViewportsOnly && Subsystem.IsValid())
+	{
+		Subsystem->Refresh(DeltaTime);
+	}
+}
+
+FString FAlsStateBatchTickFunction::DiagnosticMessage()
+{
+	return FString{ANSITEXTVIEW("UAlsStateBatchSubsystem::TickFunction")};
+}
+
+void UAlsStateBatchSubsystem::OnWorldBeginPlay(UWorld& World)
+{
+	Super::OnWorldBeginPlay(World);
+
+	// Characters tick in the pre-physics group, and each registered character
+	// waits for this tick function, so the batch is always refreshed before them.
+
+	TickFunction.Subsystem = this;
+	TickFunction.TickGroup = TG_PrePhysics;
+	TickFunction.bCanEverTick = true;
+	TickFunction.bStartWithTickEnabled = true;
+	TickFunction.RegisterTickFunction(World.PersistentLevel);
+}
+
+void UAlsStateBatchSubsystem::Deinitialize()
+{
+	if (TickFunction.IsTickFunctionRegistered())
+	{
+		TickFunction.UnRegisterTickFunction();
+	}
+
+	Characters.Reset();
+
+	Super::Deinitialize();
+}
+
+bool UAlsStateBatchSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAlsStateBatchSubsystem::RegisterCharacter(AAlsCharacter* Character)
+{
+	if (!ALS_ENSURE(IsValid(Character)) || Characters.Contains(Character))
+	{
+		return;
+	}
+
+	Characters.Emplace(Character);
+
+	Character->PrimaryActorTick.AddPrerequisite(this, TickFunction);
+
+	RefreshControllerTickPrerequisite(Character, nullptr);
+}
+
+void UAlsStateBatchSubsystem::UnregisterCharacter(AAlsCharacter* Character)
+{
+	if (Characters.RemoveSwap(Character, EAllowShrinking::No) <= 0)
+	{
+		return;
+	}
+
+	Character->PrimaryActorTick.RemovePrerequisite(this, TickFunction);
+
+	if (IsValid(Character->GetController()))
+	{
+		TickFunction.RemovePrerequisite(Character->GetController(), Character->GetController()->PrimaryActorTick);
+	}
+}
+
+void UAlsStateBatchSubsystem::RefreshControllerTickPrerequisite(AAlsCharacter* Character, AController* PreviousController)
+{
+	if (!Characters.Contains(Character))
+	{
+		return;
+	}
+
+	// The character reads the view rotation from its controller during the refresh, so the batch must wait
+	// for the controllers to tick, just like the pawn's own tick does. See AController::AddPawnTickDependency().
+
+	if (IsValid(PreviousController))
+	{
+		TickFunction.RemovePrerequisite(PreviousController, PreviousController->PrimaryActorTick);
+	}
+
+	if (IsValid(Character->GetController()))
+	{
+		TickFunction.AddPrerequisite(Character->GetController(), Character->GetController()->PrimaryActorTick);
+	}
+}
+
+void UAlsStateBatchSubsystem::Refresh(const float DeltaTime)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsStateBatchSubsystem::Refresh"), STAT_UAlsStateBatchSubsystem_Refresh, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
+	GatherBatch(DeltaTime);
+	RefreshBatch();
+	ScatterBatch();
+}
+
+void UAlsStateBatchSubsystem::GatherBatch(const float DeltaTime)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsStateBatchSubsystem::GatherBatch"), STAT_UAlsStateBatchSubsystem_GatherBatch, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
+	BatchCharacters.Reset();
+	BatchDeltaTimes.Reset();
+	BatchHadVelocities.Reset();
+	BatchVelocities.Reset();
+	BatchReplicatedViewRotations.Reset();
+	BatchMovementBases.Reset();
+	BatchViewStates.Reset();
+	BatchLocomotionStates.Reset();
+
+	for (auto i{Characters.Num() - 1}; i >= 0; i--)
+	{
+		auto* Character{Characters[i].Get()};
+		if (!IsValid(Character))
+		{
+			Characters.RemoveAtSwap(i, EAllowShrinking::No);
+			continue;
+		}
+
+		// Characters with a tick interval don't tick every frame, so they can't be refreshed by the batch.
+
+		if (!IsValid(Character->Settings) || !Character->AnimationInstance.IsValid() ||
+		    !Character->PrimaryActorTick.IsTickFunctionEnabled() || Character->PrimaryActorTick.TickInterval > 0.0f)
+		{
+			continue;
+		}
+
+		// Same delta time that the character will receive in its own tick.
+
+		const auto CharacterDeltaTime{DeltaTime * Character->CustomTimeDilation};
+
+		Character->StateBatchRefreshFrame = GFrameCounter;
+
+		float RefreshDeltaTime;
+		if (!Character->ConsumeSignificanceRefresh(CharacterDeltaTime, RefreshDeltaTime))
+		{
+			Character->RefreshThrottled();
+			continue;
+		}
+
+		Character->RefreshBeforeStateUpdate(RefreshDeltaTime);
+
+		BatchCharacters.Emplace(Character);
+		BatchDeltaTimes.Emplace(RefreshDeltaTime);
+		BatchHadVelocities.Emplace(Character->LocomotionState.bHasVelocity);
+		BatchVelocities.Emplace(Character->GetVelocity());
+		BatchReplicatedViewRotations.Emplace(Character->ReplicatedViewRotation);
+		BatchMovementBases.Emplace(Character->MovementBase);
+		BatchViewStates.Emplace(Character->ViewState);
+		BatchLocomotionStates.Emplace(Character->LocomotionState);
+	}
+
+	SET_DWORD_STAT(STAT_Als_StateBatchCharacters, BatchCharacters.Num());
+}
+
+void UAlsStateBatchSubsystem::RefreshBatch()
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsStateBatchSubsystem::RefreshBatch"), STAT_UAlsStateBatchSubsystem_RefreshBatch, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
+	const auto bListenServer{GetWorld()->IsNetMode(NM_ListenServer)};
+
+	static constexpr auto MinParallelBatchSize{32};
+
+	ParallelFor(TEXT("UAlsStateBatchSubsystem::RefreshBatch"), BatchCharacters.Num(), MinParallelBatchSize,
+	            [this, bListenServer](const int32 Index)
+	            {
+		            AAlsCharacter::RefreshViewState(BatchViewStates[Index], BatchMovementBases[Index], BatchReplicatedViewRotations[Index],
+		                                            bListenServer, BatchDeltaTimes[Index]);
+
+		            AAlsCharacter::RefreshLocomotionVelocity(BatchLocomotionStates[Index], BatchVelocities[Index]);
+	            });
+}
+
+void UAlsStateBatchSubsystem::ScatterBatch()
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsStateBatchSubsystem::ScatterBatch"), STAT_UAlsStateBatchSubsystem_ScatterBatch, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
+	for (auto i{0}; i < BatchCharacters.Num(); i++)
+	{
+		// The character can be destroyed by gameplay logic triggered during the refresh of the previous characters.
+
+		auto* Character{BatchCharacters[i]};
+		if (!IsValid(Character))
+		{
+			continue;
+		}
+
+		Character->ViewState = BatchViewStates[i];
+		Character->LocomotionState = BatchLocomotionStates[i];
+
+		Character->RefreshAfterStateUpdate(BatchDeltaTimes[i], BatchHadVelocities[i]);
+	}
+
+	BatchCharacters.Reset();
+}
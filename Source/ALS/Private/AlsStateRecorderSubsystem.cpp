@@ -0,0 +1,594 @@
+#include "AlsStateRecorderSubsystem.h"
+
+#include "AlsCharacter.h"
+#include "EngineUtils.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/Controller.h"
+#include "GameFramework/WorldSettings.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Utility/AlsLog.h"
+#include "Utility/AlsMacros.h"
+#include "Utility/AlsUtility.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsStateRecorderSubsystem)
+
+namespace AlsStateRecorderSubsystem
+{
+	static FAutoConsoleCommandWithWorldAndArgs RecordCommand{
+		TEXT("Als.StateRecorder.Record"),
+		TEXT("Starts recording the inputs of all ALS characters to the specified file. Usage: Als.StateRecorder.Record <File>"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Arguments, const UWorld* World)
+		{
+			auto* Subsystem{UWorld::GetSubsystem<UAlsStateRecorderSubsystem>(World)};
+			if (IsValid(Subsystem) && Arguments.Num() > 0)
+			{
+				Subsystem->StartRecording(Arguments[0]);
+			}
+		})
+	};
+
+	static FAutoConsoleCommandWithWorldAndArgs ReplayCommand{
+		TEXT("Als.StateRecorder.Replay"),
+		TEXT("Replays the inputs of ALS characters from the specified file. Usage: Als.StateRecorder.Replay <File>"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Arguments, const UWorld* World)
+		{
+			auto* Subsystem{UWorld::GetSubsystem<UAlsStateRecorderSubsystem>(World)};
+			if (IsValid(Subsystem) && Arguments.Num() > 0)
+			{
+				Subsystem->StartReplay(Arguments[0]);
+			}
+		})
+	};
+
+	static FAutoConsoleCommandWithWorld StopCommand{
+		TEXT("Als.StateRecorder.Stop"),
+		TEXT("Stops the current recording or replay."),
+		FConsoleCommandWithWorldDelegate::CreateLambda([](const UWorld* World)
+		{
+			auto* Subsystem{UWorld::GetSubsystem<UAlsStateRecorderSubsystem>(World)};
+			if (IsValid(Subsystem))
+			{
+				Subsystem->StopRecording();
+				Subsystem->StopReplay();
+			}
+		})
+	};
+
+	static constexpr auto InputDirectionScale{127.0f};
+}
+
+FArchive& operator<<(FArchive& Archive, FAlsRecordedCharacterState& State)
+{
+	Archive << State.CharacterIndex;
+	Archive << State.ViewModeIndex;
+	Archive << State.DesiredRotationModeIndex;
+	Archive << State.DesiredStanceIndex;
+	Archive << State.DesiredGaitIndex;
+	Archive << State.OverlayModeIndex;
+
+	auto Flags{static_cast<uint8>(State.bDesiredAiming)};
+	Archive << Flags;
+	State.bDesiredAiming = (Flags & 1) != 0;
+
+	Archive << State.MovementMode;
+	Archive << State.CustomMovementMode;
+	Archive << State.InputDirectionX;
+	Archive << State.InputDirectionY;
+	Archive << State.InputDirectionZ;
+	Archive << State.ViewPitch;
+	Archive << State.ViewYaw;
+	Archive << State.Location;
+	Archive << State.Yaw;
+	Archive << State.Velocity;
+
+	return Archive;
+}
+
+void UAlsStateRecorderSubsystem::OnWorldBeginPlay(UWorld& World)
+{
+	Super::OnWorldBeginPlay(World);
+
+	FString CommandLineFilePath;
+
+	if (FParse::Value(FCommandLine::Get(), TEXT("AlsReplay="), CommandLineFilePath))
+	{
+		StartReplay(CommandLineFilePath, FParse::Param(FCommandLine::Get(), TEXT("AlsReplayExit")));
+	}
+	else if (FParse::Value(FCommandLine::Get(), TEXT("AlsRecord="), CommandLineFilePath))
+	{
+		StartRecording(CommandLineFilePath);
+	}
+}
+
+void UAlsStateRecorderSubsystem::Deinitialize()
+{
+	StopRecording();
+	StopReplay();
+
+	Super::Deinitialize();
+}
+
+void UAlsStateRecorderSubsystem::Tick(const float DeltaTime)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsStateRecorderSubsystem::Tick"), STAT_UAlsStateRecorderSubsystem_Tick, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
+	Super::Tick(DeltaTime);
+
+	if (Mode == EAlsStateRecorderMode::Recording)
+	{
+		RecordFrame(GetWorld()->GetDeltaSeconds());
+	}
+	else if (Mode == EAlsStateRecorderMode::Replaying)
+	{
+		const auto Time{FPlatformTime::Seconds()};
+		const auto FrameTime{Time - PreviousFrameTime};
+
+		PreviousFrameTime = Time;
+		TotalFrameTime += FrameTime;
+		MaxFrameTime = FMath::Max(MaxFrameTime, FrameTime);
+
+		ReplayFrame();
+	}
+}
+
+TStatId UAlsStateRecorderSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAlsStateRecorderSubsystem, STATGROUP_Tickables)
+}
+
+bool UAlsStateRecorderSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+bool UAlsStateRecorderSubsystem::StartRecording(const FString& NewFilePath)
+{
+	if (!ALS_ENSURE_MESSAGE(Mode == EAlsStateRecorderMode::None,
+	                        TEXT("Can't start recording to %s while another recording or replay is in progress."), *NewFilePath))
+	{
+		return false;
+	}
+
+	FileArchive.Reset(IFileManager::Get().CreateFileWriter(*NewFilePath));
+	if (!FileArchive.IsValid())
+	{
+		UE_LOGF(LogAls, Error, "Failed to open %ls for state recording.", *NewFilePath);
+		return false;
+	}
+
+	auto Magic{FileMagic};
+	auto Version{FileVersion};
+
+	*FileArchive << Magic;
+	*FileArchive << Version;
+
+	Mode = EAlsStateRecorderMode::Recording;
+	FilePath = NewFilePath;
+	FramesCount = 0;
+
+	ResetTables();
+
+	UE_LOGF(LogAls, Log, "State recording to %ls started.", *FilePath);
+	return true;
+}
+
+void UAlsStateRecorderSubsystem::StopRecording()
+{
+	if (Mode != EAlsStateRecorderMode::Recording)
+	{
+		return;
+	}
+
+	FileArchive->Close();
+	FileArchive.Reset();
+
+	Mode = EAlsStateRecorderMode::None;
+
+	UE_LOGF(LogAls, Log, "State recording to %ls finished: %d frames, %d characters.", *FilePath, FramesCount, Characters.Num());
+}
+
+bool UAlsStateRecorderSubsystem::StartReplay(const FString& NewFilePath, const bool bExitOnFinished)
+{
+	if (!ALS_ENSURE_MESSAGE(Mode == EAlsStateRecorderMode::None,
+	                        TEXT("Can't start replay of %s while another recording or replay is in progress."), *NewFilePath))
+	{
+		return false;
+	}
+
+	FileArchive.Reset(IFileManager::Get().CreateFileReader(*NewFilePath));
+	if (!FileArchive.IsValid())
+	{
+		UE_LOGF(LogAls, Error, "Failed to open %ls for state replay.", *NewFilePath);
+		return false;
+	}
+
+	uint32 Magic{0};
+	uint32 Version{0};
+
+	*FileArchive << Magic;
+	*FileArchive << Version;
+
+	if (FileArchive->IsError() || Magic != FileMagic || Version != FileVersion)
+	{
+		UE_LOGF(LogAls, Error, "%ls is not a valid state recording or has an unsupported version.", *NewFilePath);
+		FileArchive.Reset();
+		return false;
+	}
+
+	Mode = EAlsStateRecorderMode::Replaying;
+	FilePath = NewFilePath;
+	FramesCount = 0;
+
+	ResetTables();
+
+	// Use the recorded frame delta times as fixed time steps so that the replay doesn't depend on the machine's performance.
+
+	bExitOnReplayFinished = bExitOnFinished;
+	bPreviousUseFixedTimeStep = FApp::UseFixedTimeStep();
+	PreviousFixedDeltaTime = FApp::GetFixedDeltaTime();
+
+	FApp::SetUseFixedTimeStep(true);
+
+	PreviousFrameTime = FPlatformTime::Seconds();
+	TotalFrameTime = 0.0;
+	MaxFrameTime = 0.0;
+	MaxLocationDrift = 0.0f;
+
+	UE_LOGF(LogAls, Log, "State replay of %ls started.", *FilePath);
+
+	// Apply the first frame right away so that it is used by the next world tick, the same way it was recorded.
+
+	ReplayFrame();
+	return true;
+}
+
+void UAlsStateRecorderSubsystem::StopReplay()
+{
+	if (Mode != EAlsStateRecorderMode::Replaying)
+	{
+		return;
+	}
+
+	FileArchive.Reset();
+
+	Mode = EAlsStateRecorderMode::None;
+
+	FApp::SetUseFixedTimeStep(bPreviousUseFixedTimeStep);
+	FApp::SetFixedDeltaTime(PreviousFixedDeltaTime);
+
+	UE_LOGF(LogAls, Log, "State replay of %ls finished: %d frames, %d characters, total time %.3f s, "
+	        "average frame time %.3f ms, max frame time %.3f ms, max location drift %.2f cm.",
+	        *FilePath, FramesCount, Characters.Num(), TotalFrameTime,
+	        FramesCount > 0 ? TotalFrameTime / FramesCount * 1000.0 : 0.0, MaxFrameTime * 1000.0, MaxLocationDrift);
+
+	if (bExitOnReplayFinished)
+	{
+		FPlatformMisc::RequestExit(false, TEXT("UAlsStateRecorderSubsystem::StopReplay"));
+	}
+}
+
+void UAlsStateRecorderSubsystem::ResetTables()
+{
+	// The tag at index 0 is always empty.
+
+	Tags.Reset();
+	Tags.Emplace();
+
+	TagIndices.Reset();
+	TagIndices.Add(FGameplayTag::EmptyTag, 0);
+
+	Characters.Reset();
+	CharacterIndices.Reset();
+}
+
+uint8 UAlsStateRecorderSubsystem::GetTagIndex(const FGameplayTag& Tag, TArray<FGameplayTag>& NewTags)
+{
+	const auto* Index{TagIndices.Find(Tag)};
+	if (Index != nullptr)
+	{
+		return *Index;
+	}
+
+	if (!ALS_ENSURE_MESSAGE(Tags.Num() <= MAX_uint8, TEXT("Too many unique tags in the state recording, %s will be recorded as empty."),
+	                        *Tag.ToString()))
+	{
+		return 0;
+	}
+
+	const auto NewIndex{static_cast<uint8>(Tags.Add(Tag))};
+
+	TagIndices.Add(Tag, NewIndex);
+	NewTags.Add(Tag);
+
+	return NewIndex;
+}
+
+void UAlsStateRecorderSubsystem::RecordFrame(const float DeltaTime)
+{
+	TArray<FGameplayTag> NewTags;
+	TArray<int32, TInlineAllocator<16>> NewCharacterIndices;
+	TArray<FAlsRecordedCharacterState> States;
+
+	for (TActorIterator<AAlsCharacter> Iterator{GetWorld()}; Iterator; ++Iterator)
+	{
+		auto* Character{*Iterator};
+		if (!IsValid(Character))
+		{
+			continue;
+		}
+
+		const auto* CharacterIndex{CharacterIndices.Find(Character)};
+		if (CharacterIndex == nullptr)
+		{
+			if (Characters.Num() > MAX_uint16)
+			{
+				continue;
+			}
+
+			const auto NewIndex{Characters.Num()};
+
+			auto& RecordedCharacter{Characters.Emplace_GetRef()};
+			RecordedCharacter.Character = Character;
+			RecordedCharacter.Name = Character->GetName();
+			RecordedCharacter.Class = Character->GetClass();
+
+			CharacterIndex = &CharacterIndices.Add(Character, static_cast<uint16>(NewIndex));
+			NewCharacterIndices.Add(NewIndex);
+		}
+
+		const auto* Movement{Character->GetCharacterMovement()};
+		const auto InputDirection{Character->GetInputDirection() * AlsStateRecorderSubsystem::InputDirectionScale};
+		const auto Velocity{Character->GetVelocity()};
+
+		auto& State{States.Emplace_GetRef()};
+		State.CharacterIndex = *CharacterIndex;
+		State.ViewModeIndex = GetTagIndex(Character->GetViewMode(), NewTags);
+		State.DesiredRotationModeIndex = GetTagIndex(Character->GetDesiredRotationMode(), NewTags);
+		State.DesiredStanceIndex = GetTagIndex(Character->GetDesiredStance(), NewTags);
+		State.DesiredGaitIndex = GetTagIndex(Character->GetDesiredGait(), NewTags);
+		State.OverlayModeIndex = GetTagIndex(Character->GetOverlayMode(), NewTags);
+		State.bDesiredAiming = Character->IsDesiredAiming();
+		State.MovementMode = Movement->MovementMode;
+		State.CustomMovementMode = Movement->CustomMovementMode;
+		State.InputDirectionX = static_cast<int8>(FMath::RoundToInt(InputDirection.X));
+		State.InputDirectionY = static_cast<int8>(FMath::RoundToInt(InputDirection.Y));
+		State.InputDirectionZ = static_cast<int8>(FMath::RoundToInt(InputDirection.Z));
+		State.ViewPitch = FRotator::CompressAxisToShort(Character->GetReplicatedViewRotation().Pitch);
+		State.ViewYaw = FRotator::CompressAxisToShort(Character->GetReplicatedViewRotation().Yaw);
+		State.Location = FVector3f{Character->GetActorLocation()};
+		State.Yaw = FRotator::CompressAxisToShort(Character->GetActorRotation().Yaw);
+		State.Velocity = FVector3f{Velocity};
+	}
+
+	auto& Archive{*FileArchive};
+
+	auto FrameDeltaTime{DeltaTime};
+	Archive << FrameDeltaTime;
+
+	auto NewTagsCount{static_cast<uint16>(NewTags.Num())};
+	Archive << NewTagsCount;
+
+	for (const auto& Tag : NewTags)
+	{
+		auto TagName{Tag.ToString()};
+		Archive << TagName;
+	}
+
+	auto NewCharactersCount{static_cast<uint16>(NewCharacterIndices.Num())};
+	Archive << NewCharactersCount;
+
+	for (const auto Index : NewCharacterIndices)
+	{
+		auto& RecordedCharacter{Characters[Index]};
+		auto ClassPath{RecordedCharacter.Class.ToString()};
+
+		Archive << RecordedCharacter.Name;
+		Archive << ClassPath;
+	}
+
+	auto StatesCount{static_cast<uint16>(States.Num())};
+	Archive << StatesCount;
+
+	for (auto& State : States)
+	{
+		Archive << State;
+	}
+
+	FramesCount += 1;
+}
+
+void UAlsStateRecorderSubsystem::ReplayFrame()
+{
+	auto& Archive{*FileArchive};
+
+	if (Archive.AtEnd())
+	{
+		StopReplay();
+		return;
+	}
+
+	auto DeltaTime{0.0f};
+	Archive << DeltaTime;
+
+	uint16 NewTagsCount{0};
+	Archive << NewTagsCount;
+
+	for (auto i{0}; i < NewTagsCount && !Archive.IsError(); i++)
+	{
+		FString TagName;
+		Archive << TagName;
+
+		Tags.Add(FGameplayTag::RequestGameplayTag(FName{TagName}, false));
+	}
+
+	uint16 NewCharactersCount{0};
+	Archive << NewCharactersCount;
+
+	for (auto i{0}; i < NewCharactersCount && !Archive.IsError(); i++)
+	{
+		FString ClassPath;
+
+		auto& RecordedCharacter{Characters.Emplace_GetRef()};
+		Archive << RecordedCharacter.Name;
+		Archive << ClassPath;
+
+		RecordedCharacter.Class = FSoftClassPath{ClassPath};
+	}
+
+	uint16 StatesCount{0};
+	Archive << StatesCount;
+
+	for (auto i{0}; i < StatesCount && !Archive.IsError(); i++)
+	{
+		FAlsRecordedCharacterState State;
+		Archive << State;
+
+		if (Archive.IsError() || !Characters.IsValidIndex(State.CharacterIndex))
+		{
+			continue;
+		}
+
+		auto& RecordedCharacter{Characters[State.CharacterIndex]};
+		if (!RecordedCharacter.bResolved)
+		{
+			RecordedCharacter.bResolved = true;
+			RecordedCharacter.Character = FindOrSpawnCharacter(RecordedCharacter, State);
+
+			if (RecordedCharacter.Character.IsValid())
+			{
+				SyncCharacterState(RecordedCharacter.Character.Get(), State);
+			}
+		}
+		else if (RecordedCharacter.Character.IsValid())
+		{
+			// The recorded inputs of the previous frame have been consumed by now, so the character should be where it
+			// was at the end of the previous recorded frame.
+
+			const FVector3f Location{RecordedCharacter.Character->GetActorLocation()};
+			MaxLocationDrift = FMath::Max(MaxLocationDrift, FVector3f::Dist(Location, RecordedCharacter.PreviousLocation));
+		}
+
+		RecordedCharacter.PreviousLocation = State.Location;
+
+		auto* Character{RecordedCharacter.Character.Get()};
+		if (IsValid(Character))
+		{
+			ApplyCharacterState(Character, State);
+		}
+	}
+
+	if (Archive.IsError())
+	{
+		UE_LOGF(LogAls, Error, "State recording %ls is corrupted, stopping replay.", *FilePath);
+		StopReplay();
+		return;
+	}
+
+	// The recorded delta time is the world delta time, which is the fixed delta time scaled by the time dilation.
+
+	const auto TimeDilation{GetWorld()->GetWorldSettings()->GetEffectiveTimeDilation()};
+	FApp::SetFixedDeltaTime(TimeDilation > UE_SMALL_NUMBER ? DeltaTime / TimeDilation : DeltaTime);
+
+	FramesCount += 1;
+}
+
+AAlsCharacter* UAlsStateRecorderSubsystem::FindOrSpawnCharacter(const FAlsRecordedCharacter& RecordedCharacter,
+                                                                 const FAlsRecordedCharacterState& State) const
+{
+	AAlsCharacter* Character{nullptr};
+
+	for (TActorIterator<AAlsCharacter> Iterator{GetWorld()}; Iterator; ++Iterator)
+	{
+		if (IsValid(*Iterator) && Iterator->GetName() == RecordedCharacter.Name)
+		{
+			Character = *Iterator;
+			break;
+		}
+	}
+
+	if (!IsValid(Character))
+	{
+		auto* CharacterClass{RecordedCharacter.Class.TryLoadClass<AAlsCharacter>()};
+		if (!IsValid(CharacterClass))
+		{
+			UE_LOGF(LogAls, Warning, "Failed to load class %ls of recorded character %ls, its state will not be replayed.",
+			        *RecordedCharacter.Class.ToString(), *RecordedCharacter.Name);
+			return nullptr;
+		}
+
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.Name = FName{RecordedCharacter.Name};
+		SpawnParameters.NameMode = FActorSpawnParameters::ESpawnActorNameMode::Requested;
+		SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		Character = GetWorld()->SpawnActor<AAlsCharacter>(CharacterClass, FVector{State.Location},
+		                                                  FRotator{0.0f, FRotator::DecompressAxisFromShort(State.Yaw), 0.0f},
+		                                                  SpawnParameters);
+		if (!IsValid(Character))
+		{
+			return nullptr;
+		}
+	}
+
+	// Replayed characters are driven only by the recorded inputs, so detach them from their controllers,
+	// which would otherwise override the movement input and view rotation, and let them move without one.
+
+	if (IsValid(Character->GetController()))
+	{
+		Character->GetController()->UnPossess();
+	}
+
+	Character->GetCharacterMovement()->bRunPhysicsWithNoController = true;
+
+	return Character;
+}
+
+void UAlsStateRecorderSubsystem::SyncCharacterState(AAlsCharacter* Character, const FAlsRecordedCharacterState& State) const
+{
+	// Movement mode changes caused by actions that aren't recorded, such as jumping, are not reproduced,
+	// so the replay only starts from the recorded transform, movement mode and velocity, and then follows the inputs.
+
+	Character->SetActorLocationAndRotation(FVector{State.Location}, FRotator{0.0f, FRotator::DecompressAxisFromShort(State.Yaw), 0.0f},
+	                                       false, nullptr, ETeleportType::TeleportPhysics);
+
+	auto* Movement{Character->GetCharacterMovement()};
+
+	if (Movement->MovementMode != State.MovementMode || Movement->CustomMovementMode != State.CustomMovementMode)
+	{
+		Movement->SetMovementMode(static_cast<EMovementMode>(State.MovementMode), State.CustomMovementMode);
+	}
+
+	Movement->Velocity = FVector{State.Velocity};
+}
+
+void UAlsStateRecorderSubsystem::ApplyCharacterState(AAlsCharacter* Character, const FAlsRecordedCharacterState& State) const
+{
+	Character->SetViewMode(GetTag(State.ViewModeIndex));
+	Character->SetDesiredRotationMode(GetTag(State.DesiredRotationModeIndex));
+	Character->SetDesiredStance(GetTag(State.DesiredStanceIndex));
+	Character->SetDesiredGait(GetTag(State.DesiredGaitIndex));
+	Character->SetOverlayMode(GetTag(State.OverlayModeIndex));
+	Character->SetDesiredAiming(State.bDesiredAiming);
+
+	const FRotator ViewRotation{
+		FRotator::DecompressAxisFromShort(State.ViewPitch), FRotator::DecompressAxisFromShort(State.ViewYaw), 0.0f
+	};
+
+	Character->SetReplicatedViewRotationFromMove(ViewRotation.GetNormalized());
+
+	const FVector InputDirection{
+		static_cast<float>(State.InputDirectionX), static_cast<float>(State.InputDirectionY), static_cast<float>(State.InputDirectionZ)
+	};
+
+	Character->AddMovementInput(InputDirection / AlsStateRecorderSubsystem::InputDirectionScale, 1.0f, true);
+}
+
+const FGameplayTag& UAlsStateRecorderSubsystem::GetTag(const uint8 Index) const
+{
+	return Tags.IsValidIndex(Index) ? Tags[Index] : FGameplayTag::EmptyTag;
+}
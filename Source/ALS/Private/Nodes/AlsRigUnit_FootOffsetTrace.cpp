@@ -1,7 +1,9 @@
 #include "Nodes/AlsRigUnit_FootOffsetTrace.h"
 
+#include "AlsFootTraceSubsystem.h"
 #include "Engine/HitResult.h"
 #include "Engine/World.h"
+#include "Utility/AlsStats.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsRigUnit_FootOffsetTrace)
 
@@ -21,9 +23,25 @@ FAlsRigUnit_FootOffsetTrace_Execute()
 	const FVector TraceStart{FootTargetLocation.X, FootTargetLocation.Y, TraceDistanceUpward};
 	const FVector TraceEnd{FootTargetLocation.X, FootTargetLocation.Y, -TraceDistanceDownward};
 
+	const auto TraceStartWorldSpace{ExecuteContext.ToWorldSpace(TraceStart)};
+	const auto TraceEndWorldSpace{ExecuteContext.ToWorldSpace(TraceEnd)};
+
+	auto* FootTraceSubsystem{bUseBatchedTrace ? ExecuteContext.GetWorld()->GetSubsystem<UAlsFootTraceSubsystem>() : nullptr};
+
 	FHitResult Hit;
-	ExecuteContext.GetWorld()->LineTraceSingleByChannel(Hit, ExecuteContext.ToWorldSpace(TraceStart), ExecuteContext.ToWorldSpace(TraceEnd),
-	                                                    TraceChannel, {__FUNCTION__, true, ExecuteContext.GetOwningActor()});
+
+	if (IsValid(FootTraceSubsystem))
+	{
+		FootTraceSubsystem->RequestTrace(BatchedTraceHandle, TraceStartWorldSpace, TraceEndWorldSpace,
+		                                 TraceChannel, ExecuteContext.GetOwningActor());
+	}
+
+	if (!IsValid(FootTraceSubsystem) || !FootTraceSubsystem->GetTraceResult(BatchedTraceHandle, bReprojectBatchedTraceHit, Hit))
+	{
+		ALS_INC_COUNTER(FootIkSceneQueries);
+		ExecuteContext.GetWorld()->LineTraceSingleByChannel(Hit, TraceStartWorldSpace, TraceEndWorldSpace,
+		                                                    TraceChannel, {__FUNCTION__, true, ExecuteContext.GetOwningActor()});
+	}
 
 	auto* DrawInterface{ExecuteContext.GetDrawInterface()};
 	if (DrawInterface != nullptr && bDrawDebug)
@@ -1,6 +1,7 @@
 #include "Notifies/AlsAnimNotify_FootstepEffects.h"
 
 #include "AlsCharacter.h"
+#include "AlsFootstepEffectsSubsystem.h"
 #include "DrawDebugHelpers.h"
 #include "NiagaraFunctionLibrary.h"
 #include "Animation/AnimInstance.h"
@@ -16,6 +17,7 @@
 #include "Utility/AlsEnumUtility.h"
 #include "Utility/AlsMacros.h"
 #include "Utility/AlsMath.h"
+#include "Utility/AlsStats.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsAnimNotify_FootstepEffects)
 
@@ -56,6 +58,18 @@ void UAlsFootstepEffectsSettings::PostEditChangeProperty(FPropertyChangedEvent&
 }
 #endif
 
+const FAlsFootstepEffectSettings* UAlsFootstepEffectsSettings::FindEffectSettings(const EPhysicalSurface SurfaceType) const
+{
+	const auto* EffectSettings{Effects.Find(SurfaceType)};
+	if (EffectSettings != nullptr)
+	{
+		return EffectSettings;
+	}
+
+	const auto* Pair{Effects.FindArbitraryElement()};
+	return Pair != nullptr ? &Pair->Value : nullptr;
+}
+
 FString UAlsAnimNotify_FootstepEffects::GetNotifyName_Implementation() const
 {
 	// For some reason editor cuts off some characters at the end of the string, so to avoid this we insert a bunch of spaces.
@@ -114,6 +128,7 @@ void UAlsAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAnimS
 	QueryParameters.bReturnPhysicalMaterial = true;
 
 	FHitResult FootstepHit;
+	ALS_INC_COUNTER(FootstepSceneQueries);
 	if (!World->LineTraceSingleByChannel(FootstepHit, FootTransform.GetLocation(),
 	                                     FootTransform.GetLocation() - FootUpAxis *
 	                                     (FootstepEffectsSettings->SurfaceTraceDistance * MeshScale),
@@ -121,6 +136,7 @@ void UAlsAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAnimS
 	{
 		// As a fallback, trace down the world Z axis if the first trace didn't hit anything.
 
+		ALS_INC_COUNTER(FootstepSceneQueries);
 		World->LineTraceSingleByChannel(FootstepHit, FootTransform.GetLocation(),
 		                                FootTransform.GetLocation() - FVector{
 			                                0.0f, 0.0f, FootstepEffectsSettings->SurfaceTraceDistance * MeshScale
@@ -141,20 +157,11 @@ void UAlsAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAnimS
 	}
 
 	const auto SurfaceType{FootstepHit.PhysMaterial.IsValid() ? FootstepHit.PhysMaterial->SurfaceType.GetValue() : SurfaceType_Default};
-	const auto* EffectSettings{FootstepEffectsSettings->Effects.Find(SurfaceType)};
+	const auto* EffectSettings{FootstepEffectsSettings->FindEffectSettings(SurfaceType)};
 
 	if (EffectSettings == nullptr)
 	{
-		const auto* Pair{FootstepEffectsSettings->Effects.FindArbitraryElement()};
-		if (Pair != nullptr)
-		{
-			EffectSettings = &Pair->Value;
-		}
-
-		if (EffectSettings == nullptr)
-		{
-			return;
-		}
+		return;
 	}
 
 	const auto FootstepLocation{FootstepHit.ImpactPoint};
@@ -174,6 +181,40 @@ void UAlsAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAnimS
 	}
 #endif
 
+	auto* FootstepEffectsSubsystem{
+		FootstepEffectsSettings->bUsePooledEffects ? World->GetSubsystem<UAlsFootstepEffectsSubsystem>() : nullptr
+	};
+
+	if (IsValid(FootstepEffectsSubsystem))
+	{
+		FAlsFootstepEffectsRequest Request;
+		Request.Settings = FootstepEffectsSettings;
+		Request.Mesh = Mesh;
+		Request.HitComponent = FootstepHit.Component;
+		Request.SurfaceType = SurfaceType;
+		Request.FootBone = FootBone;
+		Request.SoundType = SoundType;
+		Request.SignificanceTier = IsValid(Character) ? Character->GetSignificanceState().Tier : EAlsSignificanceTier::High;
+		Request.Location = FootstepLocation;
+		Request.Rotation = FootstepRotation;
+		Request.MeshScale = MeshScale;
+
+		if (bSpawnSound)
+		{
+			Request.SoundVolumeMultiplier = CalculateSoundVolumeMultiplier(Mesh);
+			Request.SoundPitchMultiplier = SoundPitchMultiplier;
+			Request.bSpawnSound = FAnimWeight::IsRelevant(Request.SoundVolumeMultiplier);
+		}
+
+		Request.bSpawnDecal = bSpawnDecal &&
+		                      (FootstepHit.ImpactNormal | FootUpAxis) >= FootstepEffectsSettings->DecalSpawnAngleThresholdCos;
+
+		Request.bSpawnParticleSystem = bSpawnParticleSystem;
+
+		FootstepEffectsSubsystem->AddRequest(Request);
+		return;
+	}
+
 	if (bSpawnSound)
 	{
 		SpawnSound(Mesh, EffectSettings->Sound, FootstepLocation, FootstepRotation);
@@ -190,8 +231,7 @@ void UAlsAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAnimS
 	}
 }
 
-void UAlsAnimNotify_FootstepEffects::SpawnSound(USkeletalMeshComponent* Mesh, const FAlsFootstepSoundSettings& SoundSettings,
-                                                const FVector& FootstepLocation, const FQuat& FootstepRotation) const
+float UAlsAnimNotify_FootstepEffects::CalculateSoundVolumeMultiplier(const USkeletalMeshComponent* Mesh) const
 {
 	auto VolumeMultiplier{SoundVolumeMultiplier};
 
@@ -200,6 +240,14 @@ void UAlsAnimNotify_FootstepEffects::SpawnSound(USkeletalMeshComponent* Mesh, co
 		VolumeMultiplier *= 1.0f - UAlsMath::Clamp01(Mesh->GetAnimInstance()->GetCurveValue(UAlsConstants::FootstepSoundBlockCurveName()));
 	}
 
+	return VolumeMultiplier;
+}
+
+void UAlsAnimNotify_FootstepEffects::SpawnSound(USkeletalMeshComponent* Mesh, const FAlsFootstepSoundSettings& SoundSettings,
+                                                const FVector& FootstepLocation, const FQuat& FootstepRotation) const
+{
+	const auto VolumeMultiplier{CalculateSoundVolumeMultiplier(Mesh)};
+
 	if (!FAnimWeight::IsRelevant(VolumeMultiplier) || !IsValid(SoundSettings.Sound.LoadSynchronous()))
 	{
 		return;
@@ -1,5 +1,8 @@
 ﻿#include "Settings/AlsAnimationInstanceSettings.h"
 
+#include "Curves/CurveFloat.h"
+#include "UObject/ObjectSaveContext.h"
+
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsAnimationInstanceSettings)
 
 UAlsAnimationInstanceSettings::UAlsAnimationInstanceSettings()
@@ -16,7 +19,55 @@ UAlsAnimationInstanceSettings::UAlsAnimationInstanceSettings()
 	InAir.GroundPredictionSweepResponses.Destructible = ECR_Block;
 }
 
+void UAlsAnimationInstanceSettings::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	// Loaded settings are baked in PostLoad(), but settings created at runtime are not loaded.
+
+	if (!HasAnyFlags(RF_ClassDefaultObject | RF_NeedLoad))
+	{
+		BakeCurves();
+	}
+
 #if WITH_EDITOR
+	if (!HasAnyFlags(RF_ClassDefaultObject))
+	{
+		ObjectPropertyChangedDelegateHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddUObject(
+			this, &ThisClass::OnObjectPropertyChanged);
+	}
+#endif
+}
+
+void UAlsAnimationInstanceSettings::PostLoad()
+{
+	Super::PostLoad();
+
+	// Assets saved with baked curves don't need to be baked again at runtime, but in the editor the curves are
+	// always baked again, since the curve assets could have been changed after the animation settings were saved.
+
+	if (WITH_EDITOR || !bCurvesBaked)
+	{
+		BakeCurves();
+	}
+}
+
+void UAlsAnimationInstanceSettings::PreSave(const FObjectPreSaveContext SaveContext)
+{
+	BakeCurves();
+
+	Super::PreSave(SaveContext);
+}
+
+#if WITH_EDITOR
+void UAlsAnimationInstanceSettings::BeginDestroy()
+{
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedDelegateHandle);
+	ObjectPropertyChangedDelegateHandle.Reset();
+
+	Super::BeginDestroy();
+}
+
 void UAlsAnimationInstanceSettings::PostEditChangeProperty(FPropertyChangedEvent& ChangedEvent)
 {
 	if (ChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_ANSI_STRING_VIEW_CHECKED(ThisClass, InAir))
@@ -24,6 +75,46 @@ void UAlsAnimationInstanceSettings::PostEditChangeProperty(FPropertyChangedEvent
 		InAir.PostEditChangeProperty(ChangedEvent);
 	}
 
+	BakeCurves();
+
 	Super::PostEditChangeProperty(ChangedEvent);
 }
+
+void UAlsAnimationInstanceSettings::OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& ChangedEvent)
+{
+	// Curve assets don't notify the animation instance settings that reference them, so the
+	// curves are baked again whenever one of the referenced curve assets is changed in the editor.
+
+	if (!IsValid(Object) || !Object->IsA<UCurveBase>())
+	{
+		return;
+	}
+
+	if (Grounded.RotationYawOffsetForwardCurve == Object || Grounded.RotationYawOffsetBackwardCurve == Object ||
+	    Grounded.RotationYawOffsetLeftCurve == Object || Grounded.RotationYawOffsetRightCurve == Object ||
+	    Standing.StrideBlendAmountWalkCurve == Object || Standing.StrideBlendAmountRunCurve == Object ||
+	    Crouching.StrideBlendAmountCurve == Object || InAir.LeanAmountCurve == Object ||
+	    InAir.GroundPredictionAmountCurve == Object)
+	{
+		BakeCurves();
+	}
+}
 #endif
+
+void UAlsAnimationInstanceSettings::BakeCurves()
+{
+	Grounded.RotationYawOffsetForwardBakedCurve.Bake(Grounded.RotationYawOffsetForwardCurve);
+	Grounded.RotationYawOffsetBackwardBakedCurve.Bake(Grounded.RotationYawOffsetBackwardCurve);
+	Grounded.RotationYawOffsetLeftBakedCurve.Bake(Grounded.RotationYawOffsetLeftCurve);
+	Grounded.RotationYawOffsetRightBakedCurve.Bake(Grounded.RotationYawOffsetRightCurve);
+
+	Standing.StrideBlendAmountWalkBakedCurve.Bake(Standing.StrideBlendAmountWalkCurve);
+	Standing.StrideBlendAmountRunBakedCurve.Bake(Standing.StrideBlendAmountRunCurve);
+
+	Crouching.StrideBlendAmountBakedCurve.Bake(Crouching.StrideBlendAmountCurve);
+
+	InAir.LeanAmountBakedCurve.Bake(InAir.LeanAmountCurve);
+	InAir.GroundPredictionAmountBakedCurve.Bake(InAir.GroundPredictionAmountCurve);
+
+	bCurvesBaked = true;
+}
@@ -14,5 +14,10 @@ void FAlsInAirSettings::PostEditChangeProperty(const FPropertyChangedEvent& Chan
 			GroundPredictionSweepResponses.SetResponse(CollisionChannel, ECR_Block);
 		}
 	}
+	else if (ChangedEvent.GetPropertyName() ==
+	         GET_MEMBER_NAME_ANSI_STRING_VIEW_CHECKED(FAlsInAirSettings, GroundPredictionSweepReuseAngleThreshold))
+	{
+		GroundPredictionSweepReuseAngleThresholdCos = FMath::Cos(FMath::DegreesToRadians(GroundPredictionSweepReuseAngleThreshold));
+	}
 }
 #endif
@@ -0,0 +1,174 @@
+#include "Settings/AlsMovementSettings.h"
+
+#include "Curves/CurveFloat.h"
+#include "Curves/CurveVector.h"
+#include "UObject/ObjectSaveContext.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsMovementSettings)
+
+const FAlsMovementGaitSettings UAlsMovementSettings::DefaultGaitSettings;
+
+void FAlsMovementGaitSettings::BakeCurves()
+{
+	if (IsValid(AccelerationAndDecelerationAndGroundFrictionCurve))
+	{
+		AccelerationBakedCurve.Bake(AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves[0]);
+		DecelerationBakedCurve.Bake(AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves[1]);
+		GroundFrictionBakedCurve.Bake(AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves[2]);
+	}
+	else
+	{
+		AccelerationBakedCurve = {};
+		DecelerationBakedCurve = {};
+		GroundFrictionBakedCurve = {};
+	}
+
+	RotationInterpolationSpeedBakedCurve.Bake(RotationInterpolationSpeedCurve);
+}
+
+void UAlsMovementSettings::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	// Loaded settings are baked and compiled in PostLoad(), but settings created at runtime are not loaded.
+
+	if (!HasAnyFlags(RF_ClassDefaultObject | RF_NeedLoad))
+	{
+		BakeCurves();
+	}
+
+#if WITH_EDITOR
+	if (!HasAnyFlags(RF_ClassDefaultObject))
+	{
+		ObjectPropertyChangedDelegateHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddUObject(
+			this, &ThisClass::OnObjectPropertyChanged);
+	}
+#endif
+}
+
+void UAlsMovementSettings::PostLoad()
+{
+	Super::PostLoad();
+
+	// Assets saved with baked curves don't need to be baked again at runtime, but in the editor the curves are
+	// always baked again, since the curve assets could have been changed after the movement settings were saved.
+
+	if (WITH_EDITOR || !bCurvesBaked)
+	{
+		BakeCurves();
+	}
+	else
+	{
+		CompileGaitSettings();
+	}
+}
+
+void UAlsMovementSettings::PreSave(const FObjectPreSaveContext SaveContext)
+{
+	BakeCurves();
+
+	Super::PreSave(SaveContext);
+}
+
+#if WITH_EDITOR
+void UAlsMovementSettings::BeginDestroy()
+{
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedDelegateHandle);
+	ObjectPropertyChangedDelegateHandle.Reset();
+
+	Super::BeginDestroy();
+}
+
+void UAlsMovementSettings::PostEditChangeProperty(FPropertyChangedEvent& ChangedEvent)
+{
+	BakeCurves();
+
+	Super::PostEditChangeProperty(ChangedEvent);
+}
+
+void UAlsMovementSettings::OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& ChangedEvent)
+{
+	// Curve assets don't notify the movement settings that reference them, so the curves
+	// are baked again whenever one of the referenced curve assets is changed in the editor.
+
+	if (!IsValid(Object) || !Object->IsA<UCurveBase>())
+	{
+		return;
+	}
+
+	for (const auto& RotationMode : RotationModes)
+	{
+		for (const auto& Stance : RotationMode.Value.Stances)
+		{
+			if (Stance.Value.AccelerationAndDecelerationAndGroundFrictionCurve == Object ||
+			    Stance.Value.RotationInterpolationSpeedCurve == Object)
+			{
+				BakeCurves();
+				return;
+			}
+		}
+	}
+}
+#endif
+
+void UAlsMovementSettings::BakeCurves()
+{
+	for (auto& RotationMode : RotationModes)
+	{
+		for (auto& Stance : RotationMode.Value.Stances)
+		{
+			Stance.Value.BakeCurves();
+		}
+	}
+
+	bCurvesBaked = true;
+
+	// The gait settings table holds copies of the gait settings, so it must be compiled again to use the baked curves.
+
+	CompileGaitSettings();
+}
+
+void UAlsMovementSettings::CompileGaitSettings()
+{
+	GaitSettingsVersion++;
+
+	GaitSettingsRotationModes.Reset();
+	GaitSettingsStances.Reset();
+
+	for (const auto& RotationMode : RotationModes)
+	{
+		GaitSettingsRotationModes.Add(RotationMode.Key);
+
+		for (const auto& Stance : RotationMode.Value.Stances)
+		{
+			GaitSettingsStances.AddUnique(Stance.Key);
+		}
+	}
+
+	GaitSettingsIndices.Init(INDEX_NONE, GaitSettingsRotationModes.Num() * GaitSettingsStances.Num());
+	GaitSettingsTable.Reset(GaitSettingsIndices.Num());
+
+	for (const auto& RotationMode : RotationModes)
+	{
+		const auto RotationModeIndex{GaitSettingsRotationModes.IndexOfByKey(RotationMode.Key)};
+
+		for (const auto& Stance : RotationMode.Value.Stances)
+		{
+			const auto Index{RotationModeIndex * GaitSettingsStances.Num() + GaitSettingsStances.IndexOfByKey(Stance.Key)};
+
+			GaitSettingsIndices[Index] = GaitSettingsTable.Add(Stance.Value);
+		}
+	}
+}
+
+int32 UAlsMovementSettings::FindGaitSettingsIndex(const FGameplayTag& RotationMode, const FGameplayTag& Stance) const
+{
+	// The tables are small, so a linear search is faster than hashing the tags.
+
+	const auto RotationModeIndex{GaitSettingsRotationModes.IndexOfByKey(RotationMode)};
+	const auto StanceIndex{GaitSettingsStances.IndexOfByKey(Stance)};
+
+	return RotationModeIndex >= 0 && StanceIndex >= 0
+		       ? GaitSettingsIndices[RotationModeIndex * GaitSettingsStances.Num() + StanceIndex]
+		       : INDEX_NONE;
+}
@@ -0,0 +1,79 @@
+#include "State/AlsViewState.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsViewState)
+
+namespace AlsViewState
+{
+	static constexpr auto AnglesCount{1u << FAlsNetViewRotation::AngleBitsCount};
+
+	// Pitch uses one bit less, and its highest value is reserved so that both -90 and 90 degrees are represented exactly.
+
+	static constexpr auto PitchesCount{AnglesCount / 2};
+
+	static constexpr auto MaxPitch{PitchesCount - 1};
+
+	static uint32 CompressAngle(const double Angle)
+	{
+		return static_cast<uint32>(FMath::RoundToInt64(FRotator::ClampAxis(Angle) * (AnglesCount / 360.0))) & (AnglesCount - 1);
+	}
+
+	static double DecompressAngle(const uint32 Value)
+	{
+		return FRotator::NormalizeAxis(Value * (360.0 / AnglesCount));
+	}
+
+	static uint32 CompressPitch(const double Pitch)
+	{
+		return static_cast<uint32>(FMath::RoundToInt64((FMath::Clamp(FRotator::NormalizeAxis(Pitch), -90.0, 90.0) + 90.0) *
+		                                               (MaxPitch / 180.0)));
+	}
+
+	static double DecompressPitch(const uint32 Value)
+	{
+		return FMath::Min(Value, MaxPitch) * (180.0 / MaxPitch) - 90.0;
+	}
+}
+
+FRotator FAlsNetViewRotation::Quantize(const FRotator& Rotation)
+{
+	return {
+		AlsViewState::DecompressPitch(AlsViewState::CompressPitch(Rotation.Pitch)),
+		AlsViewState::DecompressAngle(AlsViewState::CompressAngle(Rotation.Yaw)),
+		AlsViewState::DecompressAngle(AlsViewState::CompressAngle(Rotation.Roll))
+	};
+}
+
+bool FAlsNetViewRotation::NetSerialize(FArchive& Archive, UPackageMap* Map, bool& bSuccess)
+{
+	uint32 Pitch{0};
+	uint32 Yaw{0};
+	uint32 Roll{0};
+
+	if (Archive.IsSaving())
+	{
+		Pitch = AlsViewState::CompressPitch(Rotation.Pitch);
+		Yaw = AlsViewState::CompressAngle(Rotation.Yaw);
+		Roll = AlsViewState::CompressAngle(Rotation.Roll);
+	}
+
+	Archive.SerializeInt(Pitch, AlsViewState::PitchesCount);
+	Archive.SerializeInt(Yaw, AlsViewState::AnglesCount);
+
+	uint8 bHasRoll{Roll != 0};
+	Archive.SerializeBits(&bHasRoll, 1);
+
+	if (bHasRoll)
+	{
+		Archive.SerializeInt(Roll, AlsViewState::AnglesCount);
+	}
+
+	if (Archive.IsLoading())
+	{
+		Rotation.Pitch = AlsViewState::DecompressPitch(Pitch);
+		Rotation.Yaw = AlsViewState::DecompressAngle(Yaw);
+		Rotation.Roll = bHasRoll ? AlsViewState::DecompressAngle(Roll) : 0.0;
+	}
+
+	bSuccess = !Archive.IsError();
+	return true;
+}
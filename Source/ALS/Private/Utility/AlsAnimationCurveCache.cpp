@@ -0,0 +1,110 @@
+#include "Utility/AlsAnimationCurveCache.h"
+
+#include "Utility/AlsConstants.h"
+
+void FAlsAnimationCurveCache::Refresh(const TMap<FName, float>& Curves)
+{
+	static const auto CurveNames{
+		[]
+		{
+			TStaticArray<FName, CurvesCount> Names;
+
+			for (auto i{0}; i < CurvesCount; i++)
+			{
+				Names[i] = GetCurveName(static_cast<EAlsAnimationCurve>(i));
+			}
+
+			return Names;
+		}()
+	};
+
+	for (auto i{0}; i < CurvesCount; i++)
+	{
+		Values[i] = GetCurveValue(Curves, CurveNames[i], ElementIds[i]);
+	}
+}
+
+FName FAlsAnimationCurveCache::GetCurveName(const EAlsAnimationCurve Curve)
+{
+	switch (Curve)
+	{
+		case EAlsAnimationCurve::LayerHead:
+			return UAlsConstants::LayerHeadCurveName();
+		case EAlsAnimationCurve::LayerHeadAdditive:
+			return UAlsConstants::LayerHeadAdditiveCurveName();
+		case EAlsAnimationCurve::LayerHeadSlot:
+			return UAlsConstants::LayerHeadSlotCurveName();
+		case EAlsAnimationCurve::LayerArmLeft:
+			return UAlsConstants::LayerArmLeftCurveName();
+		case EAlsAnimationCurve::LayerArmLeftAdditive:
+			return UAlsConstants::LayerArmLeftAdditiveCurveName();
+		case EAlsAnimationCurve::LayerArmLeftLocalSpace:
+			return UAlsConstants::LayerArmLeftLocalSpaceCurveName();
+		case EAlsAnimationCurve::LayerArmLeftSlot:
+			return UAlsConstants::LayerArmLeftSlotCurveName();
+		case EAlsAnimationCurve::LayerArmRight:
+			return UAlsConstants::LayerArmRightCurveName();
+		case EAlsAnimationCurve::LayerArmRightAdditive:
+			return UAlsConstants::LayerArmRightAdditiveCurveName();
+		case EAlsAnimationCurve::LayerArmRightLocalSpace:
+			return UAlsConstants::LayerArmRightLocalSpaceCurveName();
+		case EAlsAnimationCurve::LayerArmRightSlot:
+			return UAlsConstants::LayerArmRightSlotCurveName();
+		case EAlsAnimationCurve::LayerHandLeft:
+			return UAlsConstants::LayerHandLeftCurveName();
+		case EAlsAnimationCurve::LayerHandRight:
+			return UAlsConstants::LayerHandRightCurveName();
+		case EAlsAnimationCurve::LayerSpine:
+			return UAlsConstants::LayerSpineCurveName();
+		case EAlsAnimationCurve::LayerSpineAdditive:
+			return UAlsConstants::LayerSpineAdditiveCurveName();
+		case EAlsAnimationCurve::LayerSpineSlot:
+			return UAlsConstants::LayerSpineSlotCurveName();
+		case EAlsAnimationCurve::LayerPelvis:
+			return UAlsConstants::LayerPelvisCurveName();
+		case EAlsAnimationCurve::LayerPelvisSlot:
+			return UAlsConstants::LayerPelvisSlotCurveName();
+		case EAlsAnimationCurve::LayerLegs:
+			return UAlsConstants::LayerLegsCurveName();
+		case EAlsAnimationCurve::LayerLegsSlot:
+			return UAlsConstants::LayerLegsSlotCurveName();
+		case EAlsAnimationCurve::ViewBlock:
+			return UAlsConstants::ViewBlockCurveName();
+		case EAlsAnimationCurve::HipsDirectionLock:
+			return UAlsConstants::HipsDirectionLockCurveName();
+		case EAlsAnimationCurve::PoseGait:
+			return UAlsConstants::PoseGaitCurveName();
+		case EAlsAnimationCurve::PoseMoving:
+			return UAlsConstants::PoseMovingCurveName();
+		case EAlsAnimationCurve::PoseStanding:
+			return UAlsConstants::PoseStandingCurveName();
+		case EAlsAnimationCurve::PoseCrouching:
+			return UAlsConstants::PoseCrouchingCurveName();
+		case EAlsAnimationCurve::PoseGrounded:
+			return UAlsConstants::PoseGroundedCurveName();
+		case EAlsAnimationCurve::PoseInAir:
+			return UAlsConstants::PoseInAirCurveName();
+		case EAlsAnimationCurve::PoseAiming:
+			return UAlsConstants::PoseAimingCurveName();
+		case EAlsAnimationCurve::FootLeftIk:
+			return UAlsConstants::FootLeftIkCurveName();
+		case EAlsAnimationCurve::FootLeftLock:
+			return UAlsConstants::FootLeftLockCurveName();
+		case EAlsAnimationCurve::FootRightIk:
+			return UAlsConstants::FootRightIkCurveName();
+		case EAlsAnimationCurve::FootRightLock:
+			return UAlsConstants::FootRightLockCurveName();
+		case EAlsAnimationCurve::FootPlanted:
+			return UAlsConstants::FootPlantedCurveName();
+		case EAlsAnimationCurve::FeetCrossing:
+			return UAlsConstants::FeetCrossingCurveName();
+		case EAlsAnimationCurve::AllowTransitions:
+			return UAlsConstants::AllowTransitionsCurveName();
+		case EAlsAnimationCurve::SprintBlock:
+			return UAlsConstants::SprintBlockCurveName();
+		case EAlsAnimationCurve::GroundPredictionBlock:
+			return UAlsConstants::GroundPredictionBlockCurveName();
+		default:
+			return NAME_None;
+	}
+}
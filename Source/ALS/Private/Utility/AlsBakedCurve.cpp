@@ -0,0 +1,66 @@
+#include "Utility/AlsBakedCurve.h"
+
+#include "Curves/CurveFloat.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsBakedCurve)
+
+void FAlsBakedCurve::Bake(const FRichCurve& Curve)
+{
+	auto MaxTime{0.0f};
+	Curve.GetTimeRange(MinTime, MaxTime);
+
+	TimeToSampleScale = MaxTime > MinTime ? (SamplesCount - 1) / (MaxTime - MinTime) : 0.0f;
+
+	for (auto i{0}; i < SamplesCount; i++)
+	{
+		Samples[i] = Curve.Eval(FMath::Lerp(MinTime, MaxTime, static_cast<float>(i) / (SamplesCount - 1)));
+	}
+
+	bBaked = true;
+	bConstantExtrapolation = Curve.PreInfinityExtrap == RCCE_Constant && Curve.PostInfinityExtrap == RCCE_Constant;
+}
+
+void FAlsBakedCurve::Bake(const UCurveFloat* Curve)
+{
+	if (IsValid(Curve))
+	{
+		Bake(Curve->FloatCurve);
+	}
+	else
+	{
+		*this = {};
+	}
+}
+
+float FAlsBakedCurve::EvaluateSourceCurve(const float Time, const FRichCurve* SourceCurve)
+{
+	return SourceCurve != nullptr ? SourceCurve->Eval(Time) : 0.0f;
+}
+
+float FAlsBakedCurve::EvaluateSourceCurve(const float Time, const UCurveFloat* SourceCurve)
+{
+	return IsValid(SourceCurve) ? SourceCurve->FloatCurve.Eval(Time) : 0.0f;
+}
+
+float FAlsBakedCurve::CalculateMaxError(const FRichCurve& Curve) const
+{
+	// Check several points between each pair of samples, since the error is the largest between them.
+
+	static constexpr auto PointsPerSampleCount{8};
+	static constexpr auto PointsCount{(SamplesCount - 1) * PointsPerSampleCount + 1};
+
+	auto CurveMinTime{0.0f};
+	auto CurveMaxTime{0.0f};
+	Curve.GetTimeRange(CurveMinTime, CurveMaxTime);
+
+	auto MaxError{0.0f};
+
+	for (auto i{0}; i < PointsCount; i++)
+	{
+		const auto Time{FMath::Lerp(CurveMinTime, CurveMaxTime, static_cast<float>(i) / (PointsCount - 1))};
+
+		MaxError = FMath::Max(MaxError, FMath::Abs(Evaluate(Time, &Curve) - Curve.Eval(Time)));
+	}
+
+	return MaxError;
+}
@@ -2,12 +2,204 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsMath)
 
+namespace AlsMath
+{
+	// https://theorangeduck.com/page/spring-roll-call#exactdamper
+
+	static constexpr auto InvExpQuadraticCoefficient{0.48f};
+	static constexpr auto InvExpCubicCoefficient{0.235f};
+
+	float InvExp(const float Value, const bool bFastApproximation)
+	{
+		if (!bFastApproximation)
+		{
+			return FMath::Exp(-Value);
+		}
+
+		return 1.0f / (1.0f + Value * (1.0f + Value * (InvExpQuadraticCoefficient + Value * InvExpCubicCoefficient)));
+	}
+
+	VectorRegister4Float InvExp(const VectorRegister4Float& Value, const bool bFastApproximation)
+	{
+		if (!bFastApproximation)
+		{
+			return VectorExp(VectorNegate(Value));
+		}
+
+		static constexpr auto CubicCoefficient{
+			MakeVectorRegisterFloatConstant(InvExpCubicCoefficient, InvExpCubicCoefficient, InvExpCubicCoefficient, InvExpCubicCoefficient)
+		};
+
+		static constexpr auto QuadraticCoefficient{
+			MakeVectorRegisterFloatConstant(InvExpQuadraticCoefficient, InvExpQuadraticCoefficient,
+			                                InvExpQuadraticCoefficient, InvExpQuadraticCoefficient)
+		};
+
+		auto Denominator{VectorMultiplyAdd(Value, CubicCoefficient, QuadraticCoefficient)};
+		Denominator = VectorMultiplyAdd(Denominator, Value, GlobalVectorConstants::FloatOne);
+		Denominator = VectorMultiplyAdd(Denominator, Value, GlobalVectorConstants::FloatOne);
+
+		return VectorReciprocal(Denominator);
+	}
+}
+
 float UAlsMath::SpringDamperFloat(FAlsSpringFloatState& SpringState, const float Current, const float Target, const float DeltaTime,
                                   const float Frequency, const float DampingRatio, const float TargetVelocityAmount)
 {
 	return SpringDamper(SpringState, Current, Target, DeltaTime, Frequency, DampingRatio, TargetVelocityAmount);
 }
 
+void UAlsMath::DamperExactBatch(const TArrayView<float> Values, const TConstArrayView<float> Targets,
+                                const float DeltaTime, const float HalfLife)
+{
+	check(Targets.Num() == Values.Num())
+
+	const auto Alpha{DamperExactAlpha(DeltaTime, HalfLife)};
+	const auto AlphaRegister{VectorSetFloat1(Alpha)};
+
+	auto* ValuesData{Values.GetData()};
+	const auto* TargetsData{Targets.GetData()};
+	auto Index{0};
+
+	for (; Index + 4 <= Values.Num(); Index += 4)
+	{
+		const auto ValueRegister{VectorLoad(ValuesData + Index)};
+		const auto TargetRegister{VectorLoad(TargetsData + Index)};
+
+		VectorStore(VectorMultiplyAdd(VectorSubtract(TargetRegister, ValueRegister), AlphaRegister, ValueRegister), ValuesData + Index);
+	}
+
+	for (; Index < Values.Num(); Index++)
+	{
+		ValuesData[Index] = FMath::Lerp(ValuesData[Index], TargetsData[Index], Alpha);
+	}
+}
+
+void UAlsMath::DamperExactBatch(const TArrayView<float> Values, const TConstArrayView<float> Targets,
+                                const TConstArrayView<float> HalfLives, const float DeltaTime, const bool bFastApproximation)
+{
+	check(Targets.Num() == Values.Num() && HalfLives.Num() == Values.Num())
+
+	static constexpr auto SmallNumber{MakeVectorRegisterFloatConstant(UE_SMALL_NUMBER, UE_SMALL_NUMBER, UE_SMALL_NUMBER, UE_SMALL_NUMBER)};
+
+	const auto ScaledDeltaTime{VectorSetFloat1(UE_LN2 * DeltaTime)};
+
+	auto* ValuesData{Values.GetData()};
+	const auto* TargetsData{Targets.GetData()};
+	const auto* HalfLivesData{HalfLives.GetData()};
+	auto Index{0};
+
+	for (; Index + 4 <= Values.Num(); Index += 4)
+	{
+		const auto ValueRegister{VectorLoad(ValuesData + Index)};
+		const auto TargetRegister{VectorLoad(TargetsData + Index)};
+
+		const auto Exponent{VectorDivide(ScaledDeltaTime, VectorAdd(VectorLoad(HalfLivesData + Index), SmallNumber))};
+		const auto Alpha{VectorSubtract(GlobalVectorConstants::FloatOne, AlsMath::InvExp(Exponent, bFastApproximation))};
+
+		VectorStore(VectorMultiplyAdd(VectorSubtract(TargetRegister, ValueRegister), Alpha, ValueRegister), ValuesData + Index);
+	}
+
+	for (; Index < Values.Num(); Index++)
+	{
+		const auto Exponent{UE_LN2 / (HalfLivesData[Index] + UE_SMALL_NUMBER) * DeltaTime};
+		const auto Alpha{1.0f - AlsMath::InvExp(Exponent, bFastApproximation)};
+
+		ValuesData[Index] = FMath::Lerp(ValuesData[Index], TargetsData[Index], Alpha);
+	}
+}
+
+void UAlsMath::SpringDamperBatch(const TArrayView<float> Values, const TArrayView<float> Velocities,
+                                 const TArrayView<float> PreviousTargets, const TConstArrayView<float> Targets,
+                                 const float DeltaTime, const float Frequency, const float DampingRatio, const float TargetVelocityAmount)
+{
+	check(Velocities.Num() == Values.Num() && PreviousTargets.Num() == Values.Num() && Targets.Num() == Values.Num())
+
+	if (DeltaTime <= UE_SMALL_NUMBER)
+	{
+		return;
+	}
+
+	// The spring is a linear system, so its new value and velocity are linear combinations of the current value, current
+	// velocity, target and target velocity. Find the coefficients of these combinations once by passing unit inputs
+	// to the scalar solver, so that each spring can be updated with a few multiply-adds instead of exp(), sin() and cos().
+
+	float ValueCoefficients[4];
+	float VelocityCoefficients[4];
+
+	for (auto i{0}; i < 4; i++)
+	{
+		auto Value{i == 0 ? 1.0f : 0.0f};
+		auto Velocity{i == 1 ? 1.0f : 0.0f};
+
+		FMath::SpringDamper(Value, Velocity, i == 2 ? 1.0f : 0.0f, i == 3 ? 1.0f : 0.0f, DeltaTime, Frequency, DampingRatio);
+
+		ValueCoefficients[i] = Value;
+		VelocityCoefficients[i] = Velocity;
+	}
+
+	const auto TargetVelocityScale{Clamp01(TargetVelocityAmount) / DeltaTime};
+
+	const VectorRegister4Float ValueCoefficientRegisters[]{
+		VectorSetFloat1(ValueCoefficients[0]), VectorSetFloat1(ValueCoefficients[1]),
+		VectorSetFloat1(ValueCoefficients[2]), VectorSetFloat1(ValueCoefficients[3])
+	};
+
+	const VectorRegister4Float VelocityCoefficientRegisters[]{
+		VectorSetFloat1(VelocityCoefficients[0]), VectorSetFloat1(VelocityCoefficients[1]),
+		VectorSetFloat1(VelocityCoefficients[2]), VectorSetFloat1(VelocityCoefficients[3])
+	};
+
+	const auto TargetVelocityScaleRegister{VectorSetFloat1(TargetVelocityScale)};
+
+	auto* ValuesData{Values.GetData()};
+	auto* VelocitiesData{Velocities.GetData()};
+	auto* PreviousTargetsData{PreviousTargets.GetData()};
+	const auto* TargetsData{Targets.GetData()};
+	auto Index{0};
+
+	for (; Index + 4 <= Values.Num(); Index += 4)
+	{
+		const auto ValueRegister{VectorLoad(ValuesData + Index)};
+		const auto VelocityRegister{VectorLoad(VelocitiesData + Index)};
+		const auto TargetRegister{VectorLoad(TargetsData + Index)};
+
+		const auto TargetVelocity{
+			VectorMultiply(VectorSubtract(TargetRegister, VectorLoad(PreviousTargetsData + Index)), TargetVelocityScaleRegister)
+		};
+
+		auto NewValue{VectorMultiply(ValueRegister, ValueCoefficientRegisters[0])};
+		NewValue = VectorMultiplyAdd(VelocityRegister, ValueCoefficientRegisters[1], NewValue);
+		NewValue = VectorMultiplyAdd(TargetRegister, ValueCoefficientRegisters[2], NewValue);
+		NewValue = VectorMultiplyAdd(TargetVelocity, ValueCoefficientRegisters[3], NewValue);
+
+		auto NewVelocity{VectorMultiply(ValueRegister, VelocityCoefficientRegisters[0])};
+		NewVelocity = VectorMultiplyAdd(VelocityRegister, VelocityCoefficientRegisters[1], NewVelocity);
+		NewVelocity = VectorMultiplyAdd(TargetRegister, VelocityCoefficientRegisters[2], NewVelocity);
+		NewVelocity = VectorMultiplyAdd(TargetVelocity, VelocityCoefficientRegisters[3], NewVelocity);
+
+		VectorStore(NewValue, ValuesData + Index);
+		VectorStore(NewVelocity, VelocitiesData + Index);
+		VectorStore(TargetRegister, PreviousTargetsData + Index);
+	}
+
+	for (; Index < Values.Num(); Index++)
+	{
+		const auto Value{ValuesData[Index]};
+		const auto Velocity{VelocitiesData[Index]};
+		const auto Target{TargetsData[Index]};
+		const auto TargetVelocity{(Target - PreviousTargetsData[Index]) * TargetVelocityScale};
+
+		ValuesData[Index] = Value * ValueCoefficients[0] + Velocity * ValueCoefficients[1] +
+		                    Target * ValueCoefficients[2] + TargetVelocity * ValueCoefficients[3];
+
+		VelocitiesData[Index] = Value * VelocityCoefficients[0] + Velocity * VelocityCoefficients[1] +
+		                        Target * VelocityCoefficients[2] + TargetVelocity * VelocityCoefficients[3];
+
+		PreviousTargetsData[Index] = Target;
+	}
+}
+
 EAlsMovementDirection UAlsMath::CalculateMovementDirection(const float Angle, const float ForwardHalfAngle, const float AngleThreshold)
 {
 	if (Angle >= -ForwardHalfAngle - AngleThreshold && Angle <= ForwardHalfAngle + AngleThreshold)
@@ -0,0 +1,45 @@
+#include "Utility/AlsRotation.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsRotation)
+
+void UAlsRotation::DamperExactAngleBatch(const TArrayView<float> Angles, const TConstArrayView<float> TargetAngles,
+                                         const float DeltaTime, const float HalfLife)
+{
+	check(TargetAngles.Num() == Angles.Num())
+
+	static constexpr auto RemapThreshold{
+		MakeVectorRegisterFloatConstant(180.0f - CounterClockwiseRotationAngleThreshold, 180.0f - CounterClockwiseRotationAngleThreshold,
+		                                180.0f - CounterClockwiseRotationAngleThreshold, 180.0f - CounterClockwiseRotationAngleThreshold)
+	};
+
+	static constexpr auto RemapAngles{MakeVectorRegisterFloatConstant(360.0f, 360.0f, 360.0f, 360.0f)};
+
+	const auto AlphaRegister{VectorSetFloat1(UAlsMath::DamperExactAlpha(DeltaTime, HalfLife))};
+
+	auto* AnglesData{Angles.GetData()};
+	const auto* TargetAnglesData{TargetAngles.GetData()};
+	auto Index{0};
+
+	for (; Index + 4 <= Angles.Num(); Index += 4)
+	{
+		const auto AngleRegister{VectorLoad(AnglesData + Index)};
+		const auto TargetAngleRegister{VectorLoad(TargetAnglesData + Index)};
+
+		auto Delta{VectorSubtract(TargetAngleRegister, AngleRegister)};
+		Delta = VectorNormalizeRotator(Delta);
+
+		const auto TargetReachedMask{VectorCompareLE(VectorAbs(Delta), GlobalVectorConstants::KindaSmallNumber)};
+
+		Delta = VectorSelect(VectorCompareGT(Delta, RemapThreshold), VectorSubtract(Delta, RemapAngles), Delta);
+
+		auto ResultRegister{VectorMultiplyAdd(Delta, AlphaRegister, AngleRegister)};
+		ResultRegister = VectorNormalizeRotator(ResultRegister);
+
+		VectorStore(VectorSelect(TargetReachedMask, TargetAngleRegister, ResultRegister), AnglesData + Index);
+	}
+
+	for (; Index < Angles.Num(); Index++)
+	{
+		AnglesData[Index] = DamperExactAngle(AnglesData[Index], TargetAnglesData[Index], DeltaTime, HalfLife);
+	}
+}
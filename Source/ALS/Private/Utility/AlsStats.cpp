@@ -0,0 +1,15 @@
+﻿#include "Utility/AlsStats.h"
+
+DEFINE_STAT(STAT_Als_MantlingSceneQueries)
+DEFINE_STAT(STAT_Als_GroundPredictionSceneQueries)
+DEFINE_STAT(STAT_Als_FootIkSceneQueries)
+DEFINE_STAT(STAT_Als_FootstepSceneQueries)
+DEFINE_STAT(STAT_Als_CameraSceneQueries)
+DEFINE_STAT(STAT_Als_RagdollingSceneQueries)
+DEFINE_STAT(STAT_Als_FloorQueries)
+DEFINE_STAT(STAT_Als_RpcsSent)
+DEFINE_STAT(STAT_Als_MontagesPlayed)
+DEFINE_STAT(STAT_Als_SavedMoveAllocations)
+DEFINE_STAT(STAT_Als_PeakSavedMoves)
+
+CSV_DEFINE_CATEGORY_MODULE(ALS_API, Als, true);
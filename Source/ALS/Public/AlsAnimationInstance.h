@@ -4,8 +4,10 @@
 #include "Engine/World.h"
 #include "State/AlsControlRigInput.h"
 #include "State/AlsCrouchingState.h"
+#include "State/AlsDormancyState.h"
 #include "State/AlsDynamicTransitionsState.h"
 #include "State/AlsFeetState.h"
+#include "State/AlsGroundPredictionState.h"
 #include "State/AlsGroundedState.h"
 #include "State/AlsHeadState.h"
 #include "State/AlsInAirState.h"
@@ -21,11 +23,14 @@
 #include "State/AlsTransitionsState.h"
 #include "State/AlsTurnInPlaceState.h"
 #include "State/AlsViewAnimationState.h"
+#include "Utility/AlsAnimationCurveCache.h"
 #include "Utility/AlsGameplayTags.h"
 #include "AlsAnimationInstance.generated.h"
 
 class UAlsLinkedAnimationInstance;
+class UAlsFootLockSubsystem;
 class UAlsAnimationInstanceSettings;
+struct FAlsAnimationLodLevel;
 class AAlsCharacter;
 
 UCLASS()
@@ -34,6 +39,7 @@ class ALS_API UAlsAnimationInstance : public UAnimInstance
 	GENERATED_BODY()
 
 	friend UAlsLinkedAnimationInstance;
+	friend UAlsFootLockSubsystem;
 
 protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
@@ -124,6 +130,9 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	FAlsInAirState InAirState;
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	FAlsGroundPredictionState GroundPredictionState;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	FAlsFeetState FeetState;
 
@@ -142,11 +151,48 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	FAlsRagdollingAnimationState RagdollingState;
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	FAlsDormancyState DormancyState;
+
+	/// Index of the current level in FAlsAnimationLodSettings::Levels, or INDEX_NONE if all features are enabled.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient, Meta = (ClampMin = -1))
+	int32 AnimationLodLevel{INDEX_NONE};
+
+	FAlsAnimationCurveCache CurveCache;
+
+	// Indices of the bones read in RefreshFeetOnGameThread(), resolved once per skeletal mesh in NativeInitializeAnimation().
+
+	int32 PelvisBoneIndex{INDEX_NONE};
+
+	int32 FootLeftIkBoneIndex{INDEX_NONE};
+
+	int32 FootRightIkBoneIndex{INDEX_NONE};
+
+	int32 FootLeftVirtualBoneIndex{INDEX_NONE};
+
+	int32 FootRightVirtualBoneIndex{INDEX_NONE};
+
+	// Component space bone transforms copied on the game thread in RefreshFeetOnGameThread() and read in RefreshFeetTargets(),
+	// because the mesh's component space transforms buffer can be swapped while the worker thread update is running.
+
+	FTransform PelvisTransformComponentSpace;
+
+	FTransform FootLeftTargetTransformComponentSpace;
+
+	FTransform FootRightTargetTransformComponentSpace;
+
+	/// Frame in which UAlsFootLockSubsystem last refreshed the feet as part of a batch, so the animation instance should
+	/// skip its own refresh of the feet in this frame. Compared with the current frame instead of being reset by the
+	/// animation instance's update, so that it doesn't go stale if the update is skipped.
+	uint64 FeetBatchRefreshFrame{0};
+
 public:
 	virtual void NativeInitializeAnimation() override;
 
 	virtual void NativeBeginPlay() override;
 
+	virtual void NativeUninitializeAnimation() override;
+
 	virtual void NativeUpdateAnimation(float DeltaTime) override;
 
 	virtual void NativeThreadSafeUpdateAnimation(float DeltaTime) override;
@@ -171,8 +217,20 @@ public:
 	void MarkTeleported();
 
 private:
+	void RefreshDormancyOnGameThread(float DeltaTime);
+
+	void RefreshAnimationLodOnGameThread();
+
+	int32 CalculateAnimationLodLevel() const;
+
+	void ApplyAnimationLodFallbacks();
+
+	const FAlsAnimationLodLevel& GetAnimationLodLevel() const;
+
 	void RefreshMovementBaseOnGameThread();
 
+	void RefreshCurves();
+
 	void RefreshLayering();
 
 	void RefreshPose();
@@ -271,6 +329,8 @@ public:
 private:
 	void RefreshInAirOnGameThread();
 
+	void RefreshGroundPredictionOnGameThread();
+
 protected:
 	UFUNCTION(BlueprintCallable, Category = "ALS|Animation Instance", Meta = (BlueprintThreadSafe))
 	void RefreshInAir();
@@ -279,20 +339,35 @@ protected:
 
 	void RefreshInAirLean();
 
+private:
+	bool CalculateGroundPredictionSweepVector(FVector& SweepVector) const;
+
+	bool TryReuseGroundPredictionSweep(const FVector& SweepStartLocation, const FVector& SweepVector,
+	                                   bool& bGroundValid, float& HitTime) const;
+
+	void DrawGroundPredictionSweepDebug(const FHitResult& Hit, bool bGroundValid) const;
+
 	// Feet
 
 private:
 	void RefreshFeetOnGameThread();
 
+	void RefreshFeetTargets(const FTransform& ComponentTransform);
+
 	void RefreshFeet(float DeltaTime);
 
-	void ProcessFootLockTeleport(const FAlsFootUpdateContext& Context) const;
+	void PrepareFeetUpdate(const FTransform& ComponentTransform, float DeltaTime,
+	                       FAlsFootUpdateContext& LeftContext, FAlsFootUpdateContext& RightContext);
+
+	static void SolveFootLock(FAlsFootState& FootState, const FAlsFootUpdateContext& Context);
+
+	static void ProcessFootLockTeleport(FAlsFootState& FootState, const FAlsFootUpdateContext& Context);
 
-	void ProcessFootLockBaseChange(const FAlsFootUpdateContext& Context) const;
+	static void ProcessFootLockBaseChange(FAlsFootState& FootState, const FAlsFootUpdateContext& Context);
 
-	void RefreshFootLock(const FAlsFootUpdateContext& Context) const;
+	static void RefreshFootLock(FAlsFootState& FootState, const FAlsFootUpdateContext& Context);
 
-	void ConstrainFootLock(FAlsFootState& FootState) const;
+	static void ConstrainFootLock(FAlsFootState& FootState, const FAlsFootUpdateContext& Context);
 
 	// Transitions
 
@@ -6,23 +6,26 @@
 #include "State/AlsMovementBaseState.h"
 #include "State/AlsRagdollingState.h"
 #include "State/AlsRollingState.h"
+#include "State/AlsSignificanceState.h"
 #include "State/AlsViewState.h"
 #include "Utility/AlsGameplayTags.h"
 #include "AlsCharacter.generated.h"
 
 struct FAlsMantlingParameters;
-struct FAlsMantlingTraceSettings;
 class UAlsCharacterMovementComponent;
 class UAlsCharacterSettings;
 class UAlsMovementSettings;
 class UAlsAnimationInstance;
 class UAlsMantlingSettings;
+class UAlsStateBatchSubsystem;
 
 UCLASS(AutoExpandCategories = ("Settings|Als Character", "Settings|Als Character|Desired State"))
 class ALS_API AAlsCharacter : public ACharacter
 {
 	GENERATED_BODY()
 
+	friend UAlsStateBatchSubsystem;
+
 protected:
 	UPROPERTY(BlueprintReadOnly, Category = "Als Character")
 	TObjectPtr<UAlsCharacterMovementComponent> AlsCharacterMovement;
@@ -76,10 +79,19 @@ protected:
 
 	/// Replicated raw view rotation. Depending on the context, this rotation can be in world space, or in movement
 	/// base space. In most cases, it is better to use FAlsViewState::Rotation to take advantage of network smoothing.
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient,
-		ReplicatedUsing = "OnReplicated_ReplicatedViewRotation")
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient)
 	FRotator ReplicatedViewRotation{ForceInit};
 
+	/// Quantized view rotation that is actually sent over the network. Updated only when the view rotation changes by more
+	/// than the replication angle threshold, see FAlsViewSettings. On the owning client, this is the last rotation sent
+	/// to the server, since the owning client never receives this property.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient,
+		ReplicatedUsing = "OnReplicated_NetViewRotation")
+	FAlsNetViewRotation NetViewRotation;
+
+	/// World time when the net view rotation was last updated.
+	double NetViewRotationTime{0.0};
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient)
 	FAlsViewState ViewState;
 
@@ -108,8 +120,18 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient)
 	FAlsRollingState RollingState;
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient)
+	FAlsSignificanceState SignificanceState;
+
 	FTimerHandle BrakingFrictionFactorResetTimer;
 
+	/// Frame in which UAlsStateBatchSubsystem last refreshed the character as part of a batch. Compared with the current
+	/// frame instead of being reset by the character's tick, so that it doesn't go stale if the character doesn't tick.
+	uint64 StateBatchRefreshFrame{0};
+
+	/// Intermediate results of the asynchronous mantling traces started by AAlsCharacter::AutoStartMantling().
+	FAlsMantlingTraceState AsyncMantlingTraceState;
+
 public:
 	explicit AAlsCharacter(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
@@ -126,6 +148,8 @@ public:
 protected:
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(EEndPlayReason::Type EndPlayReason) override;
+
 	virtual void CalcCamera(float DeltaTime, FMinimalViewInfo& ViewInfo) override;
 
 public:
@@ -137,11 +161,15 @@ public:
 
 	virtual void PossessedBy(AController* NewController) override;
 
+	virtual void NotifyControllerChanged() override;
+
 	virtual void Restart() override;
 
 public:
 	const UAlsCharacterSettings* GetSettings() const;
 
+	const FAlsMovementBaseState& GetMovementBase() const;
+
 protected:
 	UFUNCTION(BlueprintNativeEvent, Category = "Als Character", Meta = (ReturnDisplayName = "Handled"))
 	bool OnCalculateCamera(float DeltaTime, FMinimalViewInfo& ViewInfo);
@@ -151,6 +179,22 @@ private:
 
 	void RefreshMovementBase();
 
+	void RefreshBeforeStateUpdate(float DeltaTime);
+
+	void RefreshAfterStateUpdate(float DeltaTime, bool bHadVelocity);
+
+	void RefreshThrottled();
+
+	// Significance
+
+public:
+	const FAlsSignificanceState& GetSignificanceState() const;
+
+	void SetSignificance(EAlsSignificanceTier NewTier, float NewViewerDistance);
+
+private:
+	bool ConsumeSignificanceRefresh(float DeltaTime, float& RefreshDeltaTime);
+
 	// View Mode
 
 public:
@@ -371,21 +415,32 @@ private:
 	void SetReplicatedViewRotation(const FRotator& NewViewRotation, bool bSendRpc);
 
 	UFUNCTION(Server, Unreliable)
-	void ServerSetReplicatedViewRotation(FRotator NewViewRotation);
+	void ServerSetReplicatedViewRotation(FAlsNetViewRotation NewViewRotation);
 
 	UFUNCTION()
-	void OnReplicated_ReplicatedViewRotation();
+	void OnReplicated_NetViewRotation();
 
 public:
+	const FRotator& GetReplicatedViewRotation() const;
+
+	/// Applies the view rotation received from the owning client as part of its character move.
+	void SetReplicatedViewRotationFromMove(const FRotator& NewViewRotation);
+
 	void CorrectViewNetworkSmoothing(const FRotator& TargetRotation);
 
 public:
 	const FAlsViewState& GetViewState() const;
 
 private:
-	void RefreshView(float DeltaTime);
+	void RefreshReplicatedViewRotation();
+
+	bool TryUpdateNetViewRotation(float AngleThreshold);
+
+	static void RefreshViewState(FAlsViewState& State, const FAlsMovementBaseState& Base,
+	                             const FRotator& ReplicatedRotation, bool bListenServer, float DeltaTime);
 
-	void RefreshViewNetworkSmoothing(float DeltaTime);
+	static void RefreshViewNetworkSmoothing(FAlsViewNetworkSmoothingState& NetworkSmoothing, const FAlsMovementBaseState& Base,
+	                                        const FRotator& ReplicatedRotation, bool bListenServer, float DeltaTime);
 
 	// Locomotion
 
@@ -397,7 +452,9 @@ private:
 
 	void RefreshLocomotionEarly();
 
-	void RefreshLocomotion();
+	static void RefreshLocomotionVelocity(FAlsLocomotionState& State, const FVector& Velocity);
+
+	void RefreshLocomotion(bool bHadVelocity);
 
 	void RefreshLocomotionLate();
 
@@ -511,8 +568,26 @@ public:
 private:
 	bool AutoStartMantling();
 
+	bool AutoStartMantlingAsync();
+
+	void CancelAsyncMantlingTraces();
+
+	bool IsAsyncMantlingTraceStale() const;
+
 	bool StartMantling(const FAlsMantlingTraceSettings& TraceSettings);
 
+	bool PrepareMantlingTraces(const FAlsMantlingTraceSettings& TraceSettings, FAlsMantlingTraceState& TraceState) const;
+
+	bool StartMantlingFromLedgeIndex(FAlsMantlingTraceState& TraceState, bool& bLedgeFound);
+
+	bool ProcessMantlingForwardTrace(FAlsMantlingTraceState& TraceState);
+
+	bool ProcessMantlingDownwardTrace(FAlsMantlingTraceState& TraceState);
+
+	void StartMantlingFromTraces(const FAlsMantlingTraceState& TraceState);
+
+	void DrawMantlingTracesDebug(const FAlsMantlingTraceState& TraceState, bool bSuccess) const;
+
 	UFUNCTION(Server, Reliable)
 	void ServerStartMantling(const FAlsMantlingParameters& Parameters);
 
@@ -621,6 +696,16 @@ inline const UAlsCharacterSettings* AAlsCharacter::GetSettings() const
 	return Settings;
 }
 
+inline const FAlsMovementBaseState& AAlsCharacter::GetMovementBase() const
+{
+	return MovementBase;
+}
+
+inline const FAlsSignificanceState& AAlsCharacter::GetSignificanceState() const
+{
+	return SignificanceState;
+}
+
 inline FGameplayTag AAlsCharacter::GetViewMode() const
 {
 	return ViewMode;
@@ -681,6 +766,11 @@ inline const FVector& AAlsCharacter::GetInputDirection() const
 	return InputDirection;
 }
 
+inline const FRotator& AAlsCharacter::GetReplicatedViewRotation() const
+{
+	return ReplicatedViewRotation;
+}
+
 inline const FAlsViewState& AAlsCharacter::GetViewState() const
 {
 	return ViewState;
@@ -1,7 +1,9 @@
 #pragma once
 
 #include "GameFramework/CharacterMovementComponent.h"
+#include "Interfaces/MovementBaseInterface.h"
 #include "Settings/AlsMovementSettings.h"
+#include "State/AlsViewState.h"
 #include "AlsCharacterMovementComponent.generated.h"
 
 using FAlsPhysicsRotationDelegate = TMulticastDelegate<void(float DeltaTime)>;
@@ -11,6 +13,13 @@ class ALS_API FAlsCharacterNetworkMoveData : public FCharacterNetworkMoveData
 private:
 	using Super = FCharacterNetworkMoveData;
 
+public:
+	// Known tags are replicated as indices of this size, and the largest index is reserved for unknown tags.
+
+	static constexpr auto TagIndexBitsCount{2};
+
+	static constexpr uint8 UnknownTagIndex{(1 << TagIndexBitsCount) - 1};
+
 public:
 	FGameplayTag RotationMode{AlsRotationModeTags::ViewDirection};
 
@@ -18,10 +27,24 @@ public:
 
 	FGameplayTag MaxAllowedGait{AlsGaitTags::Running};
 
+	/// View rotation in movement base space. Sent only with new moves while the character is standing on a rotating
+	/// movement base, since otherwise the server uses the control rotation that is already part of every move.
+	FAlsNetViewRotation RelativeViewRotation;
+
+	uint8 bHasRelativeViewRotation : 1 {false};
+
 public:
 	virtual void ClientFillNetworkMoveData(const FSavedMove_Character& Move, ENetworkMoveType MoveType) override;
 
 	virtual bool Serialize(UCharacterMovementComponent& Movement, FArchive& Archive, UPackageMap* Map, ENetworkMoveType MoveType) override;
+
+	/// Serializes the relative view rotation as a single bit if there is none.
+	bool NetSerializeRelativeViewRotation(FArchive& Archive, UPackageMap* Map);
+
+	/// Serializes the tag as a single bit if it's equal to the reference tag. Otherwise, serializes its index in the known
+	/// tags array, followed by the full tag if it's not one of the known tags. Clients and servers must use the same array.
+	static bool NetSerializeTag(FArchive& Archive, UPackageMap* Map, FGameplayTag& Tag, const FGameplayTag& ReferenceTag,
+	                            TConstArrayView<const FNativeGameplayTag*> KnownTags);
 };
 
 class ALS_API FAlsCharacterNetworkMoveDataContainer : public FCharacterNetworkMoveDataContainer
@@ -45,6 +68,10 @@ public:
 
 	FGameplayTag MaxAllowedGait{AlsGaitTags::Running};
 
+	FRotator RelativeViewRotation{ForceInit};
+
+	uint8 bHasRelativeViewRotation : 1 {false};
+
 public:
 	virtual void Clear() override;
 
@@ -64,10 +91,52 @@ class ALS_API FAlsNetworkPredictionData : public FNetworkPredictionData_Client_C
 private:
 	using Super = FNetworkPredictionData_Client_Character;
 
+protected:
+	int32 PeakSavedMovesCount{0};
+
+	uint8 bFreeMovesFilled : 1 {false};
+
 public:
 	explicit FAlsNetworkPredictionData(const UCharacterMovementComponent& Movement);
 
 	virtual FSavedMovePtr AllocateNewMove() override;
+
+	/// Returns the largest number of saved moves this client has had at the same time.
+	int32 GetPeakSavedMovesCount() const;
+
+	void RefreshPeakSavedMovesCount(int32 SavedMovesCount);
+};
+
+inline int32 FAlsNetworkPredictionData::GetPeakSavedMovesCount() const
+{
+	return PeakSavedMovesCount;
+}
+
+/// Everything the floor found in UAlsCharacterMovementComponent::PhysWalking() depends on. While it doesn't
+/// change, the floor search is skipped and the current floor is reused.
+struct ALS_API FAlsFloorCache
+{
+	FMovementBaseInterfaceData MovementBaseInterfaceData;
+
+	FName BoneName;
+
+	FVector Location{ForceInit};
+
+	FVector MovementBaseLocation{ForceInit};
+
+	FQuat MovementBaseRotation{ForceInit};
+
+	float CapsuleRadius{0.0f};
+
+	float CapsuleHalfHeight{0.0f};
+
+	/// World time when the floor was last searched.
+	double Time{0.0};
+
+	uint8 bValid : 1 {false};
+
+public:
+	bool Matches(const FAlsFloorCache& Other) const;
 };
 
 UCLASS(ClassGroup = "ALS")
@@ -83,14 +152,32 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings")
 	uint8 bAllowImprovedPenetrationAdjustment : 1 {true};
 
+	/// If checked, the floor search while walking is skipped if neither the character, nor its capsule, nor its movement
+	/// base have moved since the last search, which saves scene queries for characters that are standing still on movable
+	/// or non-primitive movement bases. On other bases the character movement component already skips the floor search.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings")
+	uint8 bAllowFloorCache : 1 {true};
+
+	/// The floor is searched again after this time, even if nothing has moved, to notice floor changes that don't move the
+	/// movement base, e.g. if its collision is disabled.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings",
+		Meta = (ClampMin = 0, EditCondition = "bAllowFloorCache", ForceUnits = "s"))
+	float FloorCacheRefreshInterval{0.5f};
+
 protected:
 	FAlsCharacterNetworkMoveDataContainer MoveDataContainer;
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	TObjectPtr<UAlsMovementSettings> MovementSettings;
 
+	// Index of the current gait settings in the movement settings, so that they don't have to be copied on every
+	// rotation mode or stance change, see UAlsMovementSettings::FindGaitSettingsIndex().
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
-	FAlsMovementGaitSettings GaitSettings;
+	int32 GaitSettingsIndex{INDEX_NONE};
+
+	// Version of the movement settings gait settings table the index was found in, see
+	// UAlsMovementSettings::GetGaitSettingsVersion(). The index is found again if the table has been recompiled since.
+	int32 GaitSettingsVersion{INDEX_NONE};
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	FGameplayTag RotationMode{AlsRotationModeTags::ViewDirection};
@@ -124,6 +211,8 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	uint8 bPrePenetrationAdjustmentVelocityValid : 1 {false};
 
+	FAlsFloorCache FloorCache;
+
 public:
 	FAlsPhysicsRotationDelegate OnPhysicsRotation;
 
@@ -142,6 +231,8 @@ public:
 
 	virtual void OnMovementModeChanged(EMovementMode PreviousMovementMode, uint8 PreviousCustomMode) override;
 
+	virtual void OnTeleported() override;
+
 	virtual bool ShouldPerformAirControlForPathFollowing() const override;
 
 	virtual void UpdateBasedRotation(FRotator& FinalRotation, const FRotator& ReducedRotation) override;
@@ -169,6 +260,13 @@ protected:
 
 	virtual void PhysCustom(float DeltaTime, int32 IterationsCount) override;
 
+private:
+	bool CanUseFloorCache() const;
+
+	void CaptureFloorCache(FAlsFloorCache& Cache) const;
+
+	bool TryReuseCachedFloor(bool bZeroDelta);
+
 public:
 	virtual void ComputeFloorDist(const FVector& CapsuleLocation, float LineDistance, float SweepDistance, FFindFloorResult& OutFloorResult,
 	                              float SweepRadius, const FHitResult* DownwardSweepResult) const override;
@@ -190,6 +288,10 @@ public:
 
 	const FAlsMovementGaitSettings& GetGaitSettings() const;
 
+	UFUNCTION(BlueprintPure, Category = "ALS|Character Movement", DisplayName = "Get Gait Settings",
+		Meta = (ReturnDisplayName = "Gait Settings"))
+	FAlsMovementGaitSettings K2_GetGaitSettings() const;
+
 private:
 	void RefreshGaitSettings();
 
@@ -223,7 +325,22 @@ public:
 
 inline const FAlsMovementGaitSettings& UAlsCharacterMovementComponent::GetGaitSettings() const
 {
-	return GaitSettings;
+	if (!IsValid(MovementSettings))
+	{
+		return UAlsMovementSettings::DefaultGaitSettings;
+	}
+
+	// If the gait settings table has been recompiled, the cached index may point to another rotation mode or stance, so
+	// look the index up again until the next RefreshGaitSettings() call caches it.
+
+	return MovementSettings->GetGaitSettings(GaitSettingsVersion == MovementSettings->GetGaitSettingsVersion()
+		                                         ? GaitSettingsIndex
+		                                         : MovementSettings->FindGaitSettingsIndex(RotationMode, Stance));
+}
+
+inline FAlsMovementGaitSettings UAlsCharacterMovementComponent::K2_GetGaitSettings() const
+{
+	return GetGaitSettings();
 }
 
 inline FGameplayTag UAlsCharacterMovementComponent::GetRotationMode() const
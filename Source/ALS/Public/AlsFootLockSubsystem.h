@@ -0,0 +1,88 @@
+#pragma once
+
+#include "Engine/EngineBaseTypes.h"
+#include "State/AlsFeetState.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AlsFootLockSubsystem.generated.h"
+
+class UAlsAnimationInstance;
+class UAlsFootLockSubsystem;
+struct FAlsFootLockGroup;
+
+USTRUCT()
+struct ALS_API FAlsFootLockTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	TWeakObjectPtr<UAlsFootLockSubsystem> Subsystem;
+
+	FAlsFootLockGroup* Group{nullptr};
+
+public:
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread,
+	                         const FGraphEventRef& CompletionGraphEvent) override;
+
+	virtual FString DiagnosticMessage() override;
+};
+
+template <>
+struct TStructOpsTypeTraits<FAlsFootLockTickFunction> : public TStructOpsTypeTraitsBase2<FAlsFootLockTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+struct ALS_API FAlsFootLockGroup
+{
+	static constexpr auto MaxAnimationInstancesCount{16};
+
+	FAlsFootLockTickFunction TickFunction;
+
+	TArray<TWeakObjectPtr<UAlsAnimationInstance>, TInlineAllocator<MaxAnimationInstancesCount>> AnimationInstances;
+
+	// Animation instances refreshed in the current frame and the update contexts of their feet. Each animation instance
+	// owns two adjacent contexts, left first. Kept between frames to avoid reallocations.
+
+	TArray<UAlsAnimationInstance*, TInlineAllocator<MaxAnimationInstancesCount>> BatchAnimationInstances;
+
+	TArray<FAlsFootUpdateContext, TInlineAllocator<MaxAnimationInstancesCount * 2>> BatchFootContexts;
+};
+
+/// Refreshes the foot lock of registered animation instances in groups of up to FAlsFootLockGroup::MaxAnimationInstancesCount.
+/// Each group has its own tick function, which waits only for the characters and movement components of its animation
+/// instances, and only their skeletal meshes wait for it, so groups don't hold back the animation update of each other.
+/// The foot targets and curves of a group are read on the game thread, then the feet of the group are solved in place
+/// in a single task on a worker thread, so the animation instances skip their own refresh of the feet in this frame.
+/// Animation instances opt in via FAlsFootLockSettings::bAllowBatchedFootLock.
+UCLASS()
+class ALS_API UAlsFootLockSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	// Groups are never removed so that their tick functions keep stable addresses, instead empty groups are refilled.
+
+	TArray<TUniquePtr<FAlsFootLockGroup>> Groups;
+
+public:
+	virtual void Deinitialize() override;
+
+protected:
+	virtual bool DoesSupportWorldType(EWorldType::Type WorldType) const override;
+
+public:
+	void RegisterAnimationInstance(UAlsAnimationInstance* AnimationInstance);
+
+	void UnregisterAnimationInstance(UAlsAnimationInstance* AnimationInstance);
+
+	void RefreshGroup(FAlsFootLockGroup& Group, float DeltaTime, const FGraphEventRef& CompletionGraphEvent);
+
+private:
+	FAlsFootLockGroup* FindGroup(const UAlsAnimationInstance* AnimationInstance) const;
+
+	static void GatherGroup(FAlsFootLockGroup& Group, float DeltaTime);
+
+	static void SolveGroup(FAlsFootLockGroup& Group);
+};
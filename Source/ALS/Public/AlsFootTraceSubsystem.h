@@ -0,0 +1,94 @@
+#pragma once
+
+#include <atomic>
+
+#include "WorldCollision.h"
+#include "Engine/HitResult.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AlsFootTraceSubsystem.generated.h"
+
+struct ALS_API FAlsFootTraceSlot
+{
+	FCriticalSection Lock;
+
+	// Written by the requester, usually from animation worker threads.
+
+	uint8 bRequested : 1 {false};
+
+	FVector RequestedTraceStart{ForceInit};
+
+	FVector RequestedTraceEnd{ForceInit};
+
+	TEnumAsByte<ECollisionChannel> TraceChannel{ECC_Visibility};
+
+	TWeakObjectPtr<const AActor> IgnoredActor;
+
+	// Written by the subsystem on the game thread.
+
+	FTraceHandle TraceHandle;
+
+	uint8 bHasResult : 1 {false};
+
+	FVector ResultTraceStart{ForceInit};
+
+	/// World time at which the result was received.
+	double ResultTime{0.0};
+
+	FHitResult ResultHit;
+};
+
+USTRUCT()
+struct ALS_API FAlsFootTraceHandle
+{
+	GENERATED_BODY()
+
+	TSharedPtr<FAlsFootTraceSlot, ESPMode::ThreadSafe> Slot;
+};
+
+/// Gathers the foot traces requested during the frame and performs them on the game thread as a single batch of
+/// asynchronous line traces, so that animation worker threads don't have to perform synchronous scene queries. The
+/// results become available to the requesters in the following frames. A previous result is reused without a new
+/// trace while the trace start location stays the same, but not for longer than the result refresh interval, so that
+/// moving geometry under stationary characters is still noticed.
+UCLASS()
+class ALS_API UAlsFootTraceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/// A result is reused without a new trace while the trace start location has moved less than this value.
+	static constexpr auto MaxReuseDistance{1.0f};
+
+	/// A result is not reused without a new trace if it's older than this value, in seconds.
+	static constexpr auto ResultRefreshInterval{0.5f};
+
+	/// A result is not returned to the requester if the trace start location has moved more than this value.
+	static constexpr auto MaxReprojectionDistance{50.0f};
+
+protected:
+	FCriticalSection SlotsLock;
+
+	TArray<TWeakPtr<FAlsFootTraceSlot, ESPMode::ThreadSafe>> Slots;
+
+	std::atomic<int32> RequestsCount{0};
+
+	// Requests without a suitable result, for which the requesters have to perform synchronous traces instead.
+	mutable std::atomic<int32> FallbacksCount{0};
+
+public:
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(EWorldType::Type WorldType) const override;
+
+public:
+	// Thread safe.
+	void RequestTrace(FAlsFootTraceHandle& Handle, const FVector& TraceStart, const FVector& TraceEnd,
+	                  ECollisionChannel TraceChannel, const AActor* IgnoredActor);
+
+	// Thread safe. Returns false if there is no suitable result yet, in which case a synchronous trace should be used.
+	// Each call that returns false is subtracted from the saved queries stat.
+	bool GetTraceResult(const FAlsFootTraceHandle& Handle, bool bReprojectHit, FHitResult& Hit) const;
+};
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "Chaos/ChaosEngineInterface.h"
+#include "Notifies/AlsAnimNotify_FootstepEffects.h"
+#include "Settings/AlsSignificanceSettings.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AlsFootstepEffectsSubsystem.generated.h"
+
+class UAudioComponent;
+class UDecalComponent;
+class UPrimitiveComponent;
+class USkeletalMeshComponent;
+
+struct ALS_API FAlsFootstepEffectsRequest
+{
+	TWeakObjectPtr<const UAlsFootstepEffectsSettings> Settings;
+
+	TWeakObjectPtr<USkeletalMeshComponent> Mesh;
+
+	TWeakObjectPtr<UPrimitiveComponent> HitComponent;
+
+	TEnumAsByte<EPhysicalSurface> SurfaceType{SurfaceType_Default};
+
+	EAlsFootBone FootBone{EAlsFootBone::Left};
+
+	EAlsFootstepSoundType SoundType{EAlsFootstepSoundType::Step};
+
+	EAlsSignificanceTier SignificanceTier{EAlsSignificanceTier::High};
+
+	uint8 bSpawnSound : 1 {false};
+
+	uint8 bSpawnDecal : 1 {false};
+
+	uint8 bSpawnParticleSystem : 1 {false};
+
+	FVector Location{ForceInit};
+
+	FQuat Rotation{ForceInit};
+
+	float MeshScale{1.0f};
+
+	float SoundVolumeMultiplier{1.0f};
+
+	float SoundPitchMultiplier{1.0f};
+
+	// Set by the subsystem.
+	FVector::FReal ViewDistanceSquared{0.0f};
+};
+
+/// Spawns footstep effects requested by UAlsAnimNotify_FootstepEffects once per frame. Audio and decal components are taken
+/// from pools instead of being created for each footstep, and particle systems use the engine's Niagara component pool. The
+/// number of effects spawned per frame is limited, distant and insignificant footsteps are culled, and simultaneous footsteps
+/// on the same surface are merged into one. Used by footstep effects settings with the bUsePooledEffects option checked.
+UCLASS()
+class ALS_API UAlsFootstepEffectsSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static constexpr auto MaxEffectsPerFrame{16};
+
+	static constexpr auto MaxAudioComponents{32};
+
+	static constexpr auto MaxDecalComponents{64};
+
+protected:
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UAudioComponent>> AudioComponents;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UDecalComponent>> DecalComponents;
+
+	// World time after which the decal component with the same index can be reused.
+	TArray<double> DecalComponentsReleaseTimes;
+
+	TArray<FAlsFootstepEffectsRequest> Requests;
+
+	TArray<FVector> ViewLocations;
+
+public:
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(EWorldType::Type WorldType) const override;
+
+public:
+	void AddRequest(const FAlsFootstepEffectsRequest& Request);
+
+private:
+	void RefreshViewLocations();
+
+	bool CullRequest(FAlsFootstepEffectsRequest& Request) const;
+
+	bool TryMergeRequest(const FAlsFootstepEffectsRequest& Request, int32 AcceptedRequestsCount);
+
+	void SpawnSound(const FAlsFootstepEffectsRequest& Request, const FAlsFootstepSoundSettings& SoundSettings);
+
+	void SpawnDecal(const FAlsFootstepEffectsRequest& Request, const FAlsFootstepDecalSettings& DecalSettings);
+
+	void SpawnParticleSystem(const FAlsFootstepEffectsRequest& Request,
+	                         const FAlsFootstepParticleSystemSettings& ParticleSystemSettings) const;
+
+	UAudioComponent* AcquireAudioComponent();
+
+	void HideReleasedDecalComponents();
+
+	UDecalComponent* AcquireDecalComponent(double ReleaseTime);
+};
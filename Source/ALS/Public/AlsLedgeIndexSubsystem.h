@@ -0,0 +1,113 @@
+#pragma once
+
+#include "Engine/EngineTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "AlsLedgeIndexSubsystem.generated.h"
+
+class ULevel;
+class UPrimitiveComponent;
+
+/// Edge between a walkable top surface and a non-walkable side surface of static collision geometry.
+struct ALS_API FAlsLedge
+{
+	FVector Start{ForceInit};
+
+	FVector End{ForceInit};
+
+	/// Normal of the top surface.
+	FVector TopNormal{FVector::UpVector};
+
+	/// Horizontal direction pointing from the top surface out of the ledge.
+	FVector Direction{ForceInit};
+
+	float SideNormalZ{0.0f};
+
+	TWeakObjectPtr<UPrimitiveComponent> Primitive;
+
+	TObjectKey<ULevel> Level;
+};
+
+struct ALS_API FAlsLedgeQuery
+{
+	/// Location of the bottom of the character's capsule.
+	FVector Location{ForceInit};
+
+	/// Horizontal direction in which to look for ledges.
+	FVector Direction{ForceInit};
+
+	float MaxDistance{0.0f};
+
+	/// Maximum distance between the ledge and the line along the direction.
+	float HalfWidth{0.0f};
+
+	/// Minimum height of the ledge relative to the location.
+	float MinHeight{0.0f};
+
+	/// Maximum height of the ledge relative to the location.
+	float MaxHeight{0.0f};
+
+	float MinTopNormalZ{0.0f};
+
+	float MaxSideNormalZ{1.0f};
+
+	TEnumAsByte<ECollisionChannel> TraceChannel{ECC_Visibility};
+
+	FCollisionResponseContainer TraceResponses{ECR_Block};
+};
+
+/// Spatial hash of the ledges of static collision geometry in the world. Allows characters to look up mantling
+/// targets without any physics queries. Only simple box and convex collision of static primitives is indexed.
+/// The index is built when the world begins play and kept up to date as levels are streamed in and out.
+UCLASS()
+class ALS_API UAlsLedgeIndexSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static constexpr auto CellSize{250.0f};
+
+protected:
+	TArray<FAlsLedge> Ledges;
+
+	TMap<FIntPoint, TArray<int32>> Cells;
+
+	uint8 bIndexBuilt : 1 {false};
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	virtual void Deinitialize() override;
+
+	virtual void OnWorldBeginPlay(UWorld& World) override;
+
+protected:
+	virtual bool DoesSupportWorldType(EWorldType::Type WorldType) const override;
+
+public:
+	/// Finds the nearest ledge matching the query. Returns the ledge and the point on it closest to the query direction.
+	bool FindLedge(const FAlsLedgeQuery& Query, const FAlsLedge*& Ledge, FVector& LedgeLocation);
+
+	/// Adds the ledges of a static primitive that was created after its level was indexed, for example spawned at runtime.
+	void AddPrimitive(UPrimitiveComponent* Primitive);
+
+	void RemovePrimitive(const UPrimitiveComponent* Primitive);
+
+private:
+	void OnLevelAddedToWorld(ULevel* Level, UWorld* World);
+
+	void OnLevelRemovedFromWorld(ULevel* Level, UWorld* World);
+
+	void BuildIndex();
+
+	void IndexLevel(ULevel* Level);
+
+	void IndexPrimitive(UPrimitiveComponent* Primitive, const ULevel* Level);
+
+	void IndexConvex(TConstArrayView<FVector> Vertices, TConstArrayView<int32> Indices,
+	                 UPrimitiveComponent* Primitive, const ULevel* Level);
+
+	void AddLedgeToCells(int32 LedgeIndex);
+
+	void RebuildCells();
+};
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Settings/AlsSignificanceSettings.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AlsSignificanceSubsystem.generated.h"
+
+class AAlsCharacter;
+class APawn;
+
+/// Buckets ALS characters into significance tiers based on the distance to the nearest viewer, visibility and
+/// control. Characters in lower tiers run the expensive part of their tick at a reduced rate, see AAlsCharacter::Tick().
+UCLASS()
+class ALS_API UAlsSignificanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	TArray<TWeakObjectPtr<AAlsCharacter>> Characters;
+
+	TArray<FVector> ViewLocations;
+
+	/// Pawns possessed by the player controllers of the view locations, used to skip the character's own view location.
+	TArray<TWeakObjectPtr<const APawn>> ViewPawns;
+
+public:
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(EWorldType::Type WorldType) const override;
+
+public:
+	void RegisterCharacter(AAlsCharacter* Character);
+
+	void UnregisterCharacter(AAlsCharacter* Character);
+
+	static TStatId GetTierTickStatId(EAlsSignificanceTier Tier);
+
+private:
+	void RefreshViewLocations();
+
+	float CalculateViewerDistance(const AAlsCharacter* Character) const;
+
+	EAlsSignificanceTier CalculateTier(const AAlsCharacter* Character, float ViewerDistance) const;
+};
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "Engine/EngineBaseTypes.h"
+#include "State/AlsLocomotionState.h"
+#include "State/AlsMovementBaseState.h"
+#include "State/AlsViewState.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AlsStateBatchSubsystem.generated.h"
+
+class AAlsCharacter;
+class AController;
+class UAlsStateBatchSubsystem;
+
+USTRUCT()
+struct ALS_API FAlsStateBatchTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	TWeakObjectPtr<UAlsStateBatchSubsystem> Subsystem;
+
+public:
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread,
+	                         const FGraphEventRef& CompletionGraphEvent) override;
+
+	virtual FString DiagnosticMessage() override;
+};
+
+template <>
+struct TStructOpsTypeTraits<FAlsStateBatchTickFunction> : public TStructOpsTypeTraitsBase2<FAlsStateBatchTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+/// Refreshes the view and locomotion state of all registered characters in a single batch before they tick. The game
+/// thread dependent parts of the refresh are performed serially, and the pure math in between runs in parallel on
+/// copies of the character states gathered into separate arrays per state type. Characters opt in via UAlsCharacterSettings::bAllowBatchedStateUpdate.
+UCLASS()
+class ALS_API UAlsStateBatchSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	FAlsStateBatchTickFunction TickFunction;
+
+	TArray<TWeakObjectPtr<AAlsCharacter>> Characters;
+
+	// Copies of the states of the characters refreshed in the current batch, one array per state type. Elements
+	// with the same index belong to the same character. Kept between frames to avoid reallocations.
+
+	TArray<AAlsCharacter*> BatchCharacters;
+
+	TArray<float> BatchDeltaTimes;
+
+	TArray<bool> BatchHadVelocities;
+
+	TArray<FVector> BatchVelocities;
+
+	TArray<FRotator> BatchReplicatedViewRotations;
+
+	TArray<FAlsMovementBaseState> BatchMovementBases;
+
+	TArray<FAlsViewState> BatchViewStates;
+
+	TArray<FAlsLocomotionState> BatchLocomotionStates;
+
+public:
+	virtual void OnWorldBeginPlay(UWorld& World) override;
+
+	virtual void Deinitialize() override;
+
+protected:
+	virtual bool DoesSupportWorldType(EWorldType::Type WorldType) const override;
+
+public:
+	void RegisterCharacter(AAlsCharacter* Character);
+
+	void UnregisterCharacter(AAlsCharacter* Character);
+
+	void RefreshControllerTickPrerequisite(AAlsCharacter* Character, AController* PreviousController);
+
+	void Refresh(float DeltaTime);
+
+private:
+	void GatherBatch(float DeltaTime);
+
+	void RefreshBatch();
+
+	void ScatterBatch();
+};
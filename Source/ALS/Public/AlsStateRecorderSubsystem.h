@@ -0,0 +1,170 @@
+#pragma once
+
+#include "GameplayTagContainer.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/SoftObjectPath.h"
+#include "AlsStateRecorderSubsystem.generated.h"
+
+class AAlsCharacter;
+
+/// Inputs of a single character in a single recorded frame.
+struct ALS_API FAlsRecordedCharacterState
+{
+	uint16 CharacterIndex{0};
+
+	uint8 ViewModeIndex{0};
+
+	uint8 DesiredRotationModeIndex{0};
+
+	uint8 DesiredStanceIndex{0};
+
+	uint8 DesiredGaitIndex{0};
+
+	uint8 OverlayModeIndex{0};
+
+	uint8 bDesiredAiming : 1 {false};
+
+	uint8 MovementMode{0};
+
+	uint8 CustomMovementMode{0};
+
+	/// Input direction quantized to the [-127, 127] range per component.
+	int8 InputDirectionX{0};
+
+	int8 InputDirectionY{0};
+
+	int8 InputDirectionZ{0};
+
+	/// View rotation axes compressed with FRotator::CompressAxisToShort().
+	uint16 ViewPitch{0};
+
+	uint16 ViewYaw{0};
+
+	FVector3f Location{ForceInit};
+
+	uint16 Yaw{0};
+
+	FVector3f Velocity{ForceInit};
+
+	friend FArchive& operator<<(FArchive& Archive, FAlsRecordedCharacterState& State);
+};
+
+struct ALS_API FAlsRecordedCharacter
+{
+	TWeakObjectPtr<AAlsCharacter> Character;
+
+	FString Name;
+
+	FSoftClassPath Class;
+
+	/// Location recorded in the previous frame. During replay, the character should have reached it by the current frame.
+	FVector3f PreviousLocation{ForceInit};
+
+	/// Used during replay to spawn or find the character only once.
+	uint8 bResolved : 1 {false};
+};
+
+enum class EAlsStateRecorderMode : uint8
+{
+	None,
+	Recording,
+	Replaying
+};
+
+/// Records the inputs of all ALS characters in the world (input direction, view rotation, desired state tags, movement
+/// mode, location, rotation and velocity) every frame into a compact binary file, and replays them by feeding the recorded
+/// inputs back into the characters using the recorded world delta times as fixed time steps. This allows reproducing load spikes of large
+/// crowds independently of player input and network timing, e.g. on a build machine with -nullrhi. The recorded transform,
+/// movement mode and velocity are only applied once when a character first appears in the replay, after that they are
+/// only used to measure how far the replayed characters drift from the recording. Controlled with the Als.StateRecorder.*
+/// console commands or the -AlsRecord=<File>, -AlsReplay=<File> and -AlsReplayExit command line switches.
+UCLASS()
+class ALS_API UAlsStateRecorderSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static constexpr auto FileMagic{0x52534C41u}; // "ALSR".
+
+	static constexpr auto FileVersion{1u};
+
+protected:
+	EAlsStateRecorderMode Mode{EAlsStateRecorderMode::None};
+
+	FString FilePath;
+
+	TUniquePtr<FArchive> FileArchive;
+
+	// Tags and characters are assigned indices in the order they first appear in the recording.
+
+	TArray<FGameplayTag> Tags;
+
+	TMap<FGameplayTag, uint8> TagIndices;
+
+	TArray<FAlsRecordedCharacter> Characters;
+
+	TMap<TObjectKey<AAlsCharacter>, uint16> CharacterIndices;
+
+	int32 FramesCount{0};
+
+	uint8 bExitOnReplayFinished : 1 {false};
+
+	uint8 bPreviousUseFixedTimeStep : 1 {false};
+
+	double PreviousFixedDeltaTime{0.0};
+
+	double PreviousFrameTime{0.0};
+
+	double TotalFrameTime{0.0};
+
+	double MaxFrameTime{0.0};
+
+	float MaxLocationDrift{0.0f};
+
+public:
+	virtual void OnWorldBeginPlay(UWorld& World) override;
+
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(EWorldType::Type WorldType) const override;
+
+public:
+	EAlsStateRecorderMode GetMode() const;
+
+	bool StartRecording(const FString& NewFilePath);
+
+	void StopRecording();
+
+	bool StartReplay(const FString& NewFilePath, bool bExitOnFinished = false);
+
+	void StopReplay();
+
+private:
+	void ResetTables();
+
+	uint8 GetTagIndex(const FGameplayTag& Tag, TArray<FGameplayTag>& NewTags);
+
+	void RecordFrame(float DeltaTime);
+
+	void ReplayFrame();
+
+	AAlsCharacter* FindOrSpawnCharacter(const FAlsRecordedCharacter& RecordedCharacter,
+	                                    const FAlsRecordedCharacterState& State) const;
+
+	void SyncCharacterState(AAlsCharacter* Character, const FAlsRecordedCharacterState& State) const;
+
+	void ApplyCharacterState(AAlsCharacter* Character, const FAlsRecordedCharacterState& State) const;
+
+	const FGameplayTag& GetTag(uint8 Index) const;
+};
+
+inline EAlsStateRecorderMode UAlsStateRecorderSubsystem::GetMode() const
+{
+	return Mode;
+}
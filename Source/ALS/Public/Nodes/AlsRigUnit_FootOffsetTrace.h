@@ -1,5 +1,6 @@
 #pragma once
 
+#include "AlsFootTraceSubsystem.h"
 #include "Units/RigUnit.h"
 #include "AlsRigUnit_FootOffsetTrace.generated.h"
 
@@ -30,6 +31,15 @@ public:
 	UPROPERTY(Meta = (Input))
 	bool bEnabled{true};
 
+	/// If checked, the trace will be performed asynchronously by the UAlsFootTraceSubsystem together with the traces of all other
+	/// feet, and the result from a previous frame will be used. Falls back to a synchronous trace while no result is available.
+	UPROPERTY(Meta = (Input))
+	bool bUseBatchedTrace{false};
+
+	/// If checked, the hit from a previous frame will be moved along with the foot and projected onto the plane of the hit surface.
+	UPROPERTY(Meta = (Input, EditCondition = "bUseBatchedTrace"))
+	bool bReprojectBatchedTraceHit{true};
+
 	UPROPERTY(meta = (Input, DetailsOnly))
 	bool bDrawDebug{false};
 
@@ -39,6 +49,9 @@ public:
 	UPROPERTY(Transient, Meta = (Output))
 	FVector OffsetNormal{ForceInit};
 
+	UPROPERTY(Transient)
+	FAlsFootTraceHandle BatchedTraceHandle;
+
 public:
 	RIGVM_METHOD()
 	virtual void Execute() override;
@@ -191,10 +191,31 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ForceInlineRow))
 	TMap<TEnumAsByte<EPhysicalSurface>, FAlsFootstepEffectSettings> Effects;
 
+	/// If checked, footstep effects are spawned by the UAlsFootstepEffectsSubsystem, which reuses pooled components,
+	/// limits the number of effects spawned per frame, culls distant footsteps and merges simultaneous footsteps.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings|Pooling")
+	uint8 bUsePooledEffects : 1 {false};
+
+	/// Footstep effects are culled if they are farther than this distance from the nearest local viewer. Zero means no culling.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings|Pooling",
+		Meta = (ClampMin = 0, EditCondition = "bUsePooledEffects", ForceUnits = "cm"))
+	float CullDistance{5000.0f};
+
+	/// If checked, only sounds are spawned for footsteps of characters in the low significance tier.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings|Pooling", Meta = (EditCondition = "bUsePooledEffects"))
+	uint8 bCullLowSignificanceVisualEffects : 1 {true};
+
+	/// Footsteps on the same surface that happen in the same frame closer than this distance to each other are merged into one.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings|Pooling",
+		Meta = (ClampMin = 0, EditCondition = "bUsePooledEffects", ForceUnits = "cm"))
+	float MergeDistance{25.0f};
+
 public:
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& ChangedEvent) override;
 #endif
+
+	const FAlsFootstepEffectSettings* FindEffectSettings(EPhysicalSurface SurfaceType) const;
 };
 
 UCLASS(DisplayName = "Als Footstep Effects Animation Notify",
@@ -245,6 +266,8 @@ public:
 	                    const FAnimNotifyEventReference& NotifyEventReference) override;
 
 protected:
+	float CalculateSoundVolumeMultiplier(const USkeletalMeshComponent* Mesh) const;
+
 	void SpawnSound(USkeletalMeshComponent* Mesh, const FAlsFootstepSoundSettings& SoundSettings,
 	                const FVector& FootstepLocation, const FQuat& FootstepRotation) const;
 
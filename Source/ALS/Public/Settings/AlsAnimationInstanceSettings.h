@@ -1,5 +1,6 @@
 ﻿#pragma once
 
+#include "AlsAnimationLodSettings.h"
 #include "AlsCrouchingSettings.h"
 #include "AlsDynamicTransitionsSettings.h"
 #include "AlsFootLockSettings.h"
@@ -23,6 +24,9 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	FAlsGeneralAnimationSettings General;
 
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	FAlsAnimationLodSettings AnimationLod;
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	FAlsHeadSettings Head;
 
@@ -53,10 +57,36 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	FAlsGeneralTurnInPlaceSettings TurnInPlace;
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Settings", AdvancedDisplay)
+	uint8 bCurvesBaked : 1 {false};
+
+protected:
+#if WITH_EDITOR
+	FDelegateHandle ObjectPropertyChangedDelegateHandle;
+#endif
+
 public:
 	UAlsAnimationInstanceSettings();
 
+	virtual void PostInitProperties() override;
+
+	virtual void PostLoad() override;
+
+	virtual void PreSave(FObjectPreSaveContext SaveContext) override;
+
 #if WITH_EDITOR
+	virtual void BeginDestroy() override;
+
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& ChangedEvent) override;
 #endif
+
+	/// Bakes the grounded, standing, crouching and in air curves, see FAlsBakedCurve. Must be
+	/// called after the curves are changed at runtime, otherwise the old curves will still be used.
+	UFUNCTION(BlueprintCallable, Category = "ALS|Animation Instance Settings")
+	void BakeCurves();
+
+#if WITH_EDITOR
+private:
+	void OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& ChangedEvent);
+#endif
 };
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "AlsSignificanceSettings.h"
+#include "AlsAnimationLodSettings.generated.h"
+
+UENUM(BlueprintType)
+enum class EAlsAnimationLodFallback : uint8
+{
+	// Disabled features keep the values they had at the moment they were disabled.
+	Freeze,
+	// Disabled features reset their values to neutral ones: no head and spine rotation, no lean and no ground prediction.
+	Reset
+};
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsAnimationLodLevel
+{
+	GENERATED_BODY()
+
+	/// The level is used when the predicted LOD of the skeletal mesh is equal
+	/// to or greater than this value. A negative value disables this condition.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = -1))
+	int32 MinMeshLod{INDEX_NONE};
+
+	/// The level is used when the screen size of the skeletal mesh is less than this value. A zero value disables this condition.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	float MaxScreenSize{0.0f};
+
+	/// If checked, the level is used when the character's significance tier is equal to or lower than the significance tier below.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bUseSignificanceTier : 1 {false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (EditCondition = "bUseSignificanceTier"))
+	EAlsSignificanceTier SignificanceTier{EAlsSignificanceTier::Low};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bDisableHead : 1 {false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bDisableSpine : 1 {false};
+
+	/// Disables both grounded and in air lean.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bDisableLean : 1 {false};
+
+	/// Disables foot lock. The feet follow the animation as if their transforms were not valid.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bDisableFeet : 1 {false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bDisableGroundPrediction : 1 {false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bDisableDynamicTransitions : 1 {false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bDisableRotateInPlace : 1 {false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bDisableTurnInPlace : 1 {false};
+
+	/// Values taken by the disabled head, spine, lean and ground prediction. The feet, dynamic transitions, rotate in place and
+	/// turn in place are always reset, since otherwise the feet could stay locked or an in place animation could keep playing.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	EAlsAnimationLodFallback Fallback{EAlsAnimationLodFallback::Reset};
+};
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsAnimationLodSettings
+{
+	GENERATED_BODY()
+
+	/// If checked, the animation instance disables groups of its features depending on the current animation LOD level.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bAllowAnimationLod : 1 {false};
+
+	/// Levels should be ordered from the most to the least detailed. They are checked from last to first, and the first level whose
+	/// conditions are met (any of them) becomes the current one. If none of the levels match, all features are enabled.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (EditCondition = "bAllowAnimationLod"))
+	TArray<FAlsAnimationLodLevel> Levels;
+};
@@ -10,6 +10,12 @@ struct ALS_API FAlsFootLockSettings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	uint8 bAllowFootLock : 1 {true};
 
+	/// If checked, the foot lock is updated by UAlsFootLockSubsystem together with the feet of a group of other characters in
+	/// a task before the skeletal meshes tick, instead of in each animation instance's own update. Has no effect on
+	/// meshes that don't update every frame (update rate optimizations, tick interval, or visibility based tick options).
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bAllowBatchedFootLock : 1 {false};
+
 	/// Maximum angle by which the vector to the location of the locked foot can differ from the thigh
 	/// bone axis. This prevents legs from twisting into a spiral when the character rotates quickly.
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ClampMax = 180, ForceUnits = "deg"))
@@ -19,4 +19,20 @@ struct ALS_API FAlsGeneralAnimationSettings
 	/// The lower the value, the faster the interpolation. A zero value means instant interpolation.
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
 	float LeanInterpolationHalfLife{0.2f};
+
+	/// If checked, the animation instance skips most of its update while the character is idle, i.e. stands
+	/// still on the ground without input, montages, transitions or turns in place, and wakes up as soon as it's not.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bAllowDormancy : 1 {false};
+
+	/// Time the character must remain idle before the animation instance becomes dormant.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0, EditCondition = "bAllowDormancy", ForceUnits = "s"))
+	float DormancyDelay{1.0f};
+
+	/// The animation instance wakes up when the view rotation deviates by more
+	/// than this value from the one at which the character became idle.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0, ClampMax = 180, EditCondition = "bAllowDormancy", ForceUnits = "deg"))
+	float DormancyViewAngleThreshold{1.0f};
 };
@@ -1,5 +1,6 @@
 ﻿#pragma once
 
+#include "Utility/AlsBakedCurve.h"
 #include "AlsGroundedSettings.generated.h"
 
 class UCurveFloat;
@@ -21,6 +22,18 @@ struct ALS_API FAlsGroundedSettings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	TObjectPtr<UCurveFloat> RotationYawOffsetRightCurve;
 
+	UPROPERTY(VisibleAnywhere, Category = "ALS", AdvancedDisplay)
+	FAlsBakedCurve RotationYawOffsetForwardBakedCurve;
+
+	UPROPERTY(VisibleAnywhere, Category = "ALS", AdvancedDisplay)
+	FAlsBakedCurve RotationYawOffsetBackwardBakedCurve;
+
+	UPROPERTY(VisibleAnywhere, Category = "ALS", AdvancedDisplay)
+	FAlsBakedCurve RotationYawOffsetLeftBakedCurve;
+
+	UPROPERTY(VisibleAnywhere, Category = "ALS", AdvancedDisplay)
+	FAlsBakedCurve RotationYawOffsetRightBakedCurve;
+
 	/// The lower the value, the faster the interpolation. A zero value means instant interpolation.
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
 	float VelocityBlendInterpolationHalfLife{0.1f};
@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include "Engine/EngineTypes.h"
+#include "Utility/AlsBakedCurve.h"
 #include "AlsInAirSettings.generated.h"
 
 class UCurveFloat;
@@ -19,6 +20,12 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	TObjectPtr<UCurveFloat> GroundPredictionAmountCurve;
 
+	UPROPERTY(VisibleAnywhere, Category = "ALS", AdvancedDisplay)
+	FAlsBakedCurve LeanAmountBakedCurve;
+
+	UPROPERTY(VisibleAnywhere, Category = "ALS", AdvancedDisplay)
+	FAlsBakedCurve GroundPredictionAmountBakedCurve;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	TEnumAsByte<ECollisionChannel> GroundPredictionSweepChannel{ECC_Visibility};
 
@@ -28,6 +35,22 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "ALS", AdvancedDisplay)
 	FCollisionResponseContainer GroundPredictionSweepResponses{ECR_Ignore};
 
+	/// If checked, the ground prediction sweep will be performed asynchronously on the game thread, and its
+	/// result will be used one frame later. The result is then extrapolated and reused for the following
+	/// frames as long as the velocity direction does not change significantly, which greatly reduces the
+	/// number of sweeps performed, but makes the ground prediction slightly less accurate.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bUseAsyncGroundPredictionSweep : 1 {false};
+
+	/// The ground prediction sweep result will be reused until the angle between the current
+	/// velocity direction and the direction of the sweep becomes greater than this value.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0, ClampMax = 90, EditCondition = "bUseAsyncGroundPredictionSweep", ForceUnits = "deg"))
+	float GroundPredictionSweepReuseAngleThreshold{5.0f};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "ALS", AdvancedDisplay, Meta = (ClampMin = 0, ClampMax = 1))
+	float GroundPredictionSweepReuseAngleThresholdCos{FMath::Cos(FMath::DegreesToRadians(5.0f))};
+
 public:
 #if WITH_EDITOR
 	void PostEditChangeProperty(const FPropertyChangedEvent& ChangedEvent);
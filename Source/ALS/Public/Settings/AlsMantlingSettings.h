@@ -110,6 +110,24 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	uint8 bAutoStartMantlingInAir : 1 {true};
 
+	/// If checked, automatic mantling in air will use asynchronous traces, performing each stage of the traces in a separate
+	/// frame. This reduces the game thread cost of the traces at the expense of a few frames of delay before mantling starts.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (EditCondition = "bAutoStartMantlingInAir"))
+	uint8 bUseAsyncTracesForAutoStartMantling : 1 {false};
+
+	/// Asynchronous trace results older than this value are discarded instead of being used to start mantling.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0, EditCondition = "bAutoStartMantlingInAir && bUseAsyncTracesForAutoStartMantling", ForceUnits = "s"))
+	float AsyncTraceMaxAge{0.25f};
+
+	/// If checked, ledges of static geometry will be looked up in the UAlsLedgeIndexSubsystem first, so that the forward
+	/// and downward traces can be skipped if a ledge is found. Found ledges are used without any scene queries, so objects
+	/// that are not part of the static geometry, such as characters standing on the ledge, are not taken into account. If no
+	/// ledge is found, the usual traces are performed, so ledges that are not indexed, such as those of movable objects or
+	/// of geometry with only complex collision, can still be mantled on. Currently only affects the synchronous traces.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bUseLedgeIndex : 1 {false};
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ClampMax = 180, ForceUnits = "deg"))
 	float TraceAngleThreshold{110.0f};
 
@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include "Engine/DataAsset.h"
+#include "Utility/AlsBakedCurve.h"
 #include "Utility/AlsGameplayTags.h"
 #include "AlsMovementSettings.generated.h"
 
@@ -44,10 +45,24 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	TObjectPtr<UCurveFloat> RotationInterpolationSpeedCurve;
 
+	UPROPERTY(VisibleAnywhere, Category = "ALS", AdvancedDisplay)
+	FAlsBakedCurve AccelerationBakedCurve;
+
+	UPROPERTY(VisibleAnywhere, Category = "ALS", AdvancedDisplay)
+	FAlsBakedCurve DecelerationBakedCurve;
+
+	UPROPERTY(VisibleAnywhere, Category = "ALS", AdvancedDisplay)
+	FAlsBakedCurve GroundFrictionBakedCurve;
+
+	UPROPERTY(VisibleAnywhere, Category = "ALS", AdvancedDisplay)
+	FAlsBakedCurve RotationInterpolationSpeedBakedCurve;
+
 public:
 	float GetMaxWalkSpeed() const;
 
 	float GetMaxRunSpeed() const;
+
+	void BakeCurves();
 };
 
 USTRUCT(BlueprintType)
@@ -80,6 +95,67 @@ public:
 		{AlsRotationModeTags::ViewDirection, {}},
 		{AlsRotationModeTags::Aiming, {}}
 	};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Settings", AdvancedDisplay)
+	uint8 bCurvesBaked : 1 {false};
+
+	static const FAlsMovementGaitSettings DefaultGaitSettings;
+
+protected:
+	// The rotation modes and stances maps are compiled into a flat table, so that the gait settings can be found without
+	// hashing, since this happens on every rotation mode or stance change and for every saved move during client replays.
+
+	TArray<FGameplayTag, TInlineAllocator<4>> GaitSettingsRotationModes;
+
+	TArray<FGameplayTag, TInlineAllocator<4>> GaitSettingsStances;
+
+	// Indices in the gait settings table for each rotation mode and stance pair, or INDEX_NONE if the pair is missing.
+	TArray<int32, TInlineAllocator<16>> GaitSettingsIndices;
+
+	TArray<FAlsMovementGaitSettings> GaitSettingsTable;
+
+	// Incremented on every compilation, so that movement components can tell that their cached index is stale.
+	int32 GaitSettingsVersion{0};
+
+#if WITH_EDITOR
+	FDelegateHandle ObjectPropertyChangedDelegateHandle;
+#endif
+
+public:
+	virtual void PostInitProperties() override;
+
+	virtual void PostLoad() override;
+
+	virtual void PreSave(FObjectPreSaveContext SaveContext) override;
+
+#if WITH_EDITOR
+	virtual void BeginDestroy() override;
+
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& ChangedEvent) override;
+#endif
+
+	/// Bakes the curves of all gait settings, see FAlsBakedCurve, and compiles the gait settings again. Must be
+	/// called after the curves are changed at runtime, otherwise the old curves will still be used.
+	UFUNCTION(BlueprintCallable, Category = "ALS|Movement Settings")
+	void BakeCurves();
+
+	/// Compiles the rotation modes and stances maps into the gait settings table. Must be called after the
+	/// maps are changed at runtime, otherwise the old gait settings will still be used.
+	UFUNCTION(BlueprintCallable, Category = "ALS|Movement Settings")
+	void CompileGaitSettings();
+
+	/// Returns the index of the gait settings for the rotation mode and stance, or INDEX_NONE if there are none.
+	int32 FindGaitSettingsIndex(const FGameplayTag& RotationMode, const FGameplayTag& Stance) const;
+
+	int32 GetGaitSettingsVersion() const;
+
+	/// Returns the default gait settings if the index is invalid.
+	const FAlsMovementGaitSettings& GetGaitSettings(int32 Index) const;
+
+#if WITH_EDITOR
+private:
+	void OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& ChangedEvent);
+#endif
 };
 
 inline float FAlsMovementGaitSettings::GetMaxWalkSpeed() const
@@ -95,3 +171,13 @@ inline float FAlsMovementGaitSettings::GetMaxRunSpeed() const
 		       ? FMath::Max(RunForwardSpeed, RunBackwardSpeed)
 		       : RunForwardSpeed;
 }
+
+inline int32 UAlsMovementSettings::GetGaitSettingsVersion() const
+{
+	return GaitSettingsVersion;
+}
+
+inline const FAlsMovementGaitSettings& UAlsMovementSettings::GetGaitSettings(const int32 Index) const
+{
+	return GaitSettingsTable.IsValidIndex(Index) ? GaitSettingsTable[Index] : DefaultGaitSettings;
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "AlsSignificanceSettings.generated.h"
+
+UENUM(BlueprintType)
+enum class EAlsSignificanceTier : uint8
+{
+	High,
+	Medium,
+	Low
+};
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsSignificanceSettings
+{
+	GENERATED_BODY()
+
+	/// If checked, the character's tick work will be throttled depending on its significance tier. Locally
+	/// controlled characters, characters controlled by remote players and characters performing any
+	/// locomotion action (mantling, ragdolling, rolling, etc.) always stay in the high significance tier.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS")
+	uint8 bAllowTickThrottling : 1 {false};
+
+	/// Character moves to the medium significance tier if they are farther than this distance from the nearest viewer.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS",
+		Meta = (ClampMin = 0, EditCondition = "bAllowTickThrottling", ForceUnits = "cm"))
+	float MediumTierDistance{1500.0f};
+
+	/// Character moves to the low significance tier if they are farther than this distance from the nearest viewer.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS",
+		Meta = (ClampMin = 0, EditCondition = "bAllowTickThrottling", ForceUnits = "cm"))
+	float LowTierDistance{4000.0f};
+
+	/// Tier distances are offset by this value depending on the current tier to prevent the
+	/// character from constantly switching tiers while standing near one of the tier distances.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS",
+		Meta = (ClampMin = 0, EditCondition = "bAllowTickThrottling", ForceUnits = "cm"))
+	float TierDistanceHysteresis{200.0f};
+
+	/// If checked, characters that have not been rendered recently are moved one tier lower. Ignored on dedicated servers.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS", Meta = (EditCondition = "bAllowTickThrottling"))
+	uint8 bLowerTierWhenNotRendered : 1 {true};
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS",
+		Meta = (ClampMin = 0, EditCondition = "bAllowTickThrottling", ForceUnits = "s"))
+	float MediumTierRefreshInterval{1.0f / 30.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS",
+		Meta = (ClampMin = 0, EditCondition = "bAllowTickThrottling", ForceUnits = "s"))
+	float LowTierRefreshInterval{0.1f};
+
+public:
+	float GetRefreshInterval(EAlsSignificanceTier Tier) const;
+};
+
+inline float FAlsSignificanceSettings::GetRefreshInterval(const EAlsSignificanceTier Tier) const
+{
+	switch (Tier)
+	{
+		case EAlsSignificanceTier::Medium:
+			return MediumTierRefreshInterval;
+
+		case EAlsSignificanceTier::Low:
+			return LowTierRefreshInterval;
+
+		default:
+			return 0.0f;
+	}
+}
@@ -1,5 +1,6 @@
 ﻿#pragma once
 
+#include "Utility/AlsBakedCurve.h"
 #include "AlsStandingSettings.generated.h"
 
 class UCurveFloat;
@@ -26,6 +27,12 @@ struct ALS_API FAlsStandingSettings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	TObjectPtr<UCurveFloat> StrideBlendAmountRunCurve;
 
+	UPROPERTY(VisibleAnywhere, Category = "ALS", AdvancedDisplay)
+	FAlsBakedCurve StrideBlendAmountWalkBakedCurve;
+
+	UPROPERTY(VisibleAnywhere, Category = "ALS", AdvancedDisplay)
+	FAlsBakedCurve StrideBlendAmountRunBakedCurve;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm/s"))
 	float PivotActivationSpeedThreshold{200.0f};
 };
@@ -12,4 +12,31 @@ struct ALS_API FAlsViewSettings
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS")
 	uint8 bEnableListenServerNetworkSmoothing : 1 {true};
+
+	/// The view rotation is sent over the network only when it differs from the last sent rotation by more than this
+	/// angle. Smaller changes are sent once the replication interval has elapsed, so the final rotation is always sent.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS", Meta = (ClampMin = 0, ClampMax = 10, ForceUnits = "deg"))
+	float ReplicationAngleThreshold{0.1f};
+
+	/// On the server, the replication angle threshold grows linearly with the distance from the character to the nearest
+	/// viewer beyond this distance, so distant characters are replicated less often with the same on-screen error.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float ReplicationThresholdDistance{1000.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS", Meta = (ClampMin = 0, ClampMax = 45, ForceUnits = "deg"))
+	float MaxReplicationAngleThreshold{2.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float ReplicationInterval{0.25f};
+
+public:
+	float GetReplicationAngleThreshold(float ViewerDistance) const;
 };
+
+inline float FAlsViewSettings::GetReplicationAngleThreshold(const float ViewerDistance) const
+{
+	const auto DistanceScale{ReplicationThresholdDistance > UE_KINDA_SMALL_NUMBER ? ViewerDistance / ReplicationThresholdDistance : 1.0f};
+
+	return FMath::Min(ReplicationAngleThreshold * FMath::Max(1.0f, DistanceScale),
+	                  FMath::Max(ReplicationAngleThreshold, MaxReplicationAngleThreshold));
+}
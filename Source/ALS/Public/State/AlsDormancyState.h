@@ -0,0 +1,32 @@
+﻿#pragma once
+
+#include "AlsDormancyState.generated.h"
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsDormancyState
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bDormant : 1 {false};
+
+	/// Time during which the character has been continuously idle.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float IdleTime{0.0f};
+
+	/// Character location at the moment it became idle.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FVector Location{ForceInit};
+
+	/// Character rotation at the moment it became idle.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FRotator Rotation{ForceInit};
+
+	/// View rotation at the moment the character became idle.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FRotator ViewRotation{ForceInit};
+
+	/// Duration of the last full update, used to estimate the time saved while dormant. Only measured when stats are enabled.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "ms"))
+	float UpdateTime{0.0f};
+};
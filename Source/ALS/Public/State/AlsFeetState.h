@@ -78,17 +78,43 @@ struct ALS_API FAlsFeetState
 	};
 };
 
+// Everything the foot lock needs to update a single foot, so that the update doesn't have to access the animation
+// instance and can be performed for the feet of multiple characters at once. See UAlsFootLockSubsystem.
+
 struct ALS_API FAlsFootUpdateContext
 {
 	FTransform ComponentTransform;
 
 	FTransform ComponentTransformInverse;
 
-	FAlsFootState* FootState{nullptr};
+	FVector MovementBaseLocation{ForceInit};
+
+	FQuat MovementBaseRotation{ForceInit};
+
+	FQuat4f PelvisRotation{ForceInit};
 
 	float IkAmount{0.0f};
 
 	float LockAmount{0.0f};
 
 	float DeltaTime{0.0f};
+
+	float ThighAngleLimit{0.0f};
+
+	float FootAngleLimit{0.0f};
+
+	uint8 bAllowFootLock : 1 {false};
+
+	uint8 bFeetBecameValid : 1 {false};
+
+	/// Indicates that the character was teleported recently.
+	uint8 bTeleported : 1 {false};
+
+	uint8 bMovementBaseChanged : 1 {false};
+
+	uint8 bMovementBaseHasRelativeLocation : 1 {false};
+
+	uint8 bMovingSmooth : 1 {false};
+
+	uint8 bGrounded : 1 {false};
 };
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "WorldCollision.h"
+#include "AlsGroundPredictionState.generated.h"
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsGroundPredictionState
+{
+	GENERATED_BODY()
+
+	FTraceHandle SweepHandle;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bHasSweepResult : 1 {false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bGroundValid : 1 {false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FVector SweepStartLocation{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FVector SweepDirection{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float SweepDistance{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float HitDistance{0.0f};
+
+	/// Time when the sweep result was received.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ForceUnits = "s"))
+	double SweepResultTime{0.0};
+};
@@ -1,5 +1,8 @@
 ﻿#pragma once
 
+#include "Engine/HitResult.h"
+#include "Settings/AlsMantlingSettings.h"
+#include "WorldCollision.h"
 #include "AlsMantlingState.generated.h"
 
 USTRUCT(BlueprintType)
@@ -10,3 +13,66 @@ struct ALS_API FAlsMantlingState
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	int32 RootMotionSourceId{0};
 };
+
+enum class EAlsMantlingTraceStage : uint8
+{
+	None,
+	ForwardTrace,
+	DownwardTrace,
+	TargetLocationOverlap,
+	StartLocationOverlap
+};
+
+/// Intermediate results of the mantling traces. Used within a single frame by the synchronous traces, and
+/// kept between frames by the asynchronous traces, where each stage is performed in a separate frame.
+struct ALS_API FAlsMantlingTraceState
+{
+	FAlsMantlingTraceSettings TraceSettings;
+
+	/// The stage currently being performed, or the stage that failed once the traces are finished.
+	EAlsMantlingTraceStage Stage{EAlsMantlingTraceStage::None};
+
+	FTraceHandle TraceHandle;
+
+	double StartTime{0.0};
+
+	float CapsuleScale{1.0f};
+
+	float CapsuleRadius{0.0f};
+
+	float CapsuleHalfHeight{0.0f};
+
+	float TraceCapsuleRadius{0.0f};
+
+	float LedgeHeightDelta{0.0f};
+
+	FVector CapsuleBottomLocation{ForceInit};
+
+	FVector ForwardTraceStart{ForceInit};
+
+	FVector ForwardTraceEnd{ForceInit};
+
+	float ForwardTraceCapsuleHalfHeight{0.0f};
+
+	FHitResult ForwardTraceHit;
+
+	TWeakObjectPtr<UPrimitiveComponent> TargetPrimitive;
+
+	FVector TargetPrimitiveLocation{ForceInit};
+
+	FVector TargetDirection{ForceInit};
+
+	FVector DownwardTraceStart{ForceInit};
+
+	FVector DownwardTraceEnd{ForceInit};
+
+	FHitResult DownwardTraceHit;
+
+	FVector TargetLocation{ForceInit};
+
+	FVector TargetCapsuleLocation{ForceInit};
+
+	FVector StartLocation{ForceInit};
+
+	float StartLocationTraceCapsuleHalfHeight{0.0f};
+};
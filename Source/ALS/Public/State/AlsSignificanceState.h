@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Settings/AlsSignificanceSettings.h"
+#include "AlsSignificanceState.generated.h"
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsSignificanceState
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	EAlsSignificanceTier Tier{EAlsSignificanceTier::High};
+
+	/// Time accumulated since the last full refresh. Passed as the delta time to the next full refresh.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float AccumulatedDeltaTime{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ForceUnits = "s"))
+	float RefreshDelay{0.0f};
+
+	/// Distance to the nearest viewer other than the character's own player.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float ViewerDistance{0.0f};
+};
@@ -2,6 +2,40 @@
 
 #include "AlsViewState.generated.h"
 
+class UPackageMap;
+
+/// View rotation quantized for replication. Yaw and roll are quantized over the full circle. Pitch is clamped to the
+/// [-90, 90] range and quantized over it, so it never wraps around and takes one bit less for the same precision.
+/// Roll is usually zero, in which case it takes a single bit. With the default bit count, the precision
+/// matches FRotator::SerializeCompressedShort(), which is about 0.0055 degrees.
+USTRUCT(BlueprintType)
+struct ALS_API FAlsNetViewRotation
+{
+	GENERATED_BODY()
+
+	static constexpr auto AngleBitsCount{16};
+
+	static_assert(AngleBitsCount >= 8 && AngleBitsCount <= 24);
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FRotator Rotation{ForceInit};
+
+public:
+	/// Returns the rotation exactly as it will be received after replication.
+	static FRotator Quantize(const FRotator& Rotation);
+
+	bool NetSerialize(FArchive& Archive, UPackageMap* Map, bool& bSuccess);
+};
+
+template <>
+struct TStructOpsTypeTraits<FAlsNetViewRotation> : public TStructOpsTypeTraitsBase2<FAlsNetViewRotation>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
 USTRUCT(BlueprintType)
 struct ALS_API FAlsViewNetworkSmoothingState
 {
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "Containers/StaticArray.h"
+#include "Utility/AlsMath.h"
+
+enum class EAlsAnimationCurve : uint8
+{
+	LayerHead,
+	LayerHeadAdditive,
+	LayerHeadSlot,
+	LayerArmLeft,
+	LayerArmLeftAdditive,
+	LayerArmLeftLocalSpace,
+	LayerArmLeftSlot,
+	LayerArmRight,
+	LayerArmRightAdditive,
+	LayerArmRightLocalSpace,
+	LayerArmRightSlot,
+	LayerHandLeft,
+	LayerHandRight,
+	LayerSpine,
+	LayerSpineAdditive,
+	LayerSpineSlot,
+	LayerPelvis,
+	LayerPelvisSlot,
+	LayerLegs,
+	LayerLegsSlot,
+	ViewBlock,
+	HipsDirectionLock,
+	PoseGait,
+	PoseMoving,
+	PoseStanding,
+	PoseCrouching,
+	PoseGrounded,
+	PoseInAir,
+	PoseAiming,
+	FootLeftIk,
+	FootLeftLock,
+	FootRightIk,
+	FootRightLock,
+	FootPlanted,
+	FeetCrossing,
+	AllowTransitions,
+	SprintBlock,
+	GroundPredictionBlock,
+	Count
+};
+
+/// Flat snapshot of the animation curves used by the ALS animation instance. The location of each curve in the animation
+/// curves map is remembered between refreshes, so as long as the set of curves doesn't change, all curves are read in a
+/// single linear pass with one name comparison per curve instead of hashing the curve names on every lookup.
+struct ALS_API FAlsAnimationCurveCache
+{
+	static constexpr auto CurvesCount{static_cast<int32>(EAlsAnimationCurve::Count)};
+
+	TStaticArray<FSetElementId, CurvesCount> ElementIds;
+
+	TStaticArray<float, CurvesCount> Values{InPlace, 0.0f};
+
+public:
+	void Refresh(const TMap<FName, float>& Curves);
+
+	float GetValue(EAlsAnimationCurve Curve) const;
+
+	float GetValueClamped01(EAlsAnimationCurve Curve) const;
+
+	static FName GetCurveName(EAlsAnimationCurve Curve);
+
+	// Tries the element id from the previous call before falling back to the hash lookup, which updates the element id.
+	static float GetCurveValue(const TMap<FName, float>& Curves, FName CurveName, FSetElementId& ElementId);
+};
+
+inline float FAlsAnimationCurveCache::GetValue(const EAlsAnimationCurve Curve) const
+{
+	return Values[static_cast<int32>(Curve)];
+}
+
+inline float FAlsAnimationCurveCache::GetValueClamped01(const EAlsAnimationCurve Curve) const
+{
+	return UAlsMath::Clamp01(GetValue(Curve));
+}
+
+inline float FAlsAnimationCurveCache::GetCurveValue(const TMap<FName, float>& Curves, const FName CurveName, FSetElementId& ElementId)
+{
+	if (!Curves.IsValidId(ElementId) || Curves.Get(ElementId).Key != CurveName)
+	{
+		ElementId = Curves.FindId(CurveName);
+	}
+
+	return Curves.IsValidId(ElementId) ? Curves.Get(ElementId).Value : 0.0f;
+}
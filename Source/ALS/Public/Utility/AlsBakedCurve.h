@@ -0,0 +1,96 @@
+#pragma once
+
+#include "AlsBakedCurve.generated.h"
+
+struct FRichCurve;
+class UCurveFloat;
+
+/// Float curve baked into a fixed number of uniformly spaced samples over its key range. It's evaluated with a linear
+/// interpolation between two samples instead of a binary search over the curve keys. Outside the key range, the first
+/// or last sample is used if the source curve uses the default constant extrapolation, otherwise the source curve is
+/// evaluated there. Baked curves are stored in the settings assets next to their source curves, so they are baked in
+/// the editor and cooked along with the assets. Until a curve is baked, its source curve is evaluated instead.
+USTRUCT()
+struct ALS_API FAlsBakedCurve
+{
+	GENERATED_BODY()
+
+	static constexpr auto SamplesCount{64};
+
+	UPROPERTY(VisibleAnywhere, Category = "ALS")
+	float MinTime{0.0f};
+
+	/// Converts the time to a fractional sample index. Zero if the curve has less than two keys.
+	UPROPERTY(VisibleAnywhere, Category = "ALS")
+	float TimeToSampleScale{0.0f};
+
+	UPROPERTY(VisibleAnywhere, Category = "ALS")
+	float Samples[SamplesCount]{};
+
+	UPROPERTY(VisibleAnywhere, Category = "ALS")
+	uint8 bBaked : 1 {false};
+
+	/// Indicates whether the source curve uses a constant extrapolation on both sides, so that the baked curve can be
+	/// clamped to the key range. Otherwise, the source curve is evaluated outside the key range.
+	UPROPERTY(VisibleAnywhere, Category = "ALS")
+	uint8 bConstantExtrapolation : 1 {true};
+
+public:
+	void Bake(const FRichCurve& Curve);
+
+	/// Bakes the curve if it's valid, otherwise resets the baked curve.
+	void Bake(const UCurveFloat* Curve);
+
+	/// The source curve is only evaluated if the baked curve can't be used, and may be null, in which case zero is returned.
+	float Evaluate(float Time, const FRichCurve* SourceCurve) const;
+
+	/// The source curve is only evaluated if the baked curve can't be used, and may be null, in which case zero is returned.
+	float Evaluate(float Time, const UCurveFloat* SourceCurve) const;
+
+	/// Returns the maximum absolute difference between the baked and the source curves in the key range.
+	float CalculateMaxError(const FRichCurve& Curve) const;
+
+private:
+	bool TryEvaluateBaked(float Time, float& Value) const;
+
+	static float EvaluateSourceCurve(float Time, const FRichCurve* SourceCurve);
+
+	static float EvaluateSourceCurve(float Time, const UCurveFloat* SourceCurve);
+};
+
+inline float FAlsBakedCurve::Evaluate(const float Time, const FRichCurve* SourceCurve) const
+{
+	auto Value{0.0f};
+	return TryEvaluateBaked(Time, Value) ? Value : EvaluateSourceCurve(Time, SourceCurve);
+}
+
+inline float FAlsBakedCurve::Evaluate(const float Time, const UCurveFloat* SourceCurve) const
+{
+	auto Value{0.0f};
+	return TryEvaluateBaked(Time, Value) ? Value : EvaluateSourceCurve(Time, SourceCurve);
+}
+
+inline bool FAlsBakedCurve::TryEvaluateBaked(const float Time, float& Value) const
+{
+	if (!bBaked)
+	{
+		return false;
+	}
+
+	auto SampleIndex{(Time - MinTime) * TimeToSampleScale};
+
+	if (SampleIndex < 0.0f || SampleIndex > static_cast<float>(SamplesCount - 1))
+	{
+		if (!bConstantExtrapolation)
+		{
+			return false;
+		}
+
+		SampleIndex = FMath::Clamp(SampleIndex, 0.0f, static_cast<float>(SamplesCount - 1));
+	}
+
+	const auto Index{FMath::Min(static_cast<int32>(SampleIndex), SamplesCount - 2)};
+
+	Value = FMath::Lerp(Samples[Index], Samples[Index + 1], SampleIndex - static_cast<float>(Index));
+	return true;
+}
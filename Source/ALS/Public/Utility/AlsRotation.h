@@ -40,6 +40,9 @@ public:
 		Meta = (AutoCreateRefTerm = "Current, Target", ReturnDisplayName = "Rotation"))
 	static FRotator DamperExactRotation(const FRotator& Current, const FRotator& Target, float DeltaTime, float HalfLife);
 
+	/// Same as DamperExactAngle(), but damps all angles towards their targets with the same half-life, 4 at a time.
+	static void DamperExactAngleBatch(TArrayView<float> Angles, TConstArrayView<float> TargetAngles, float DeltaTime, float HalfLife);
+
 	/// Same as FMath::QInterpTo(), but uses FQuat::FastLerp() instead of FQuat::Slerp().
 	UFUNCTION(BlueprintPure, Category = "ALS|Rotation Utility", Meta = (ReturnDisplayName = "Quaternion"))
 	static FQuat InterpolateQuaternionFast(const FQuat& Current, const FQuat& Target, float DeltaTime, float Speed);
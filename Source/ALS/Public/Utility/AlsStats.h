@@ -0,0 +1,35 @@
+﻿#pragma once
+
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Utility/AlsUtility.h"
+
+// Per-frame counters of scene queries, RPCs, montages and saved move allocations issued by ALS. Visible with the "stat Als"
+// console command and also recorded into the "Als" CSV profiler category, so that they can be tracked on headless servers.
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Mantling Scene Queries"), STAT_Als_MantlingSceneQueries, STATGROUP_Als, ALS_API)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Ground Prediction Scene Queries"), STAT_Als_GroundPredictionSceneQueries, STATGROUP_Als, ALS_API)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Foot IK Scene Queries"), STAT_Als_FootIkSceneQueries, STATGROUP_Als, ALS_API)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Footstep Scene Queries"), STAT_Als_FootstepSceneQueries, STATGROUP_Als, ALS_API)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Camera Scene Queries"), STAT_Als_CameraSceneQueries, STATGROUP_Als, ALS_API)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Ragdolling Scene Queries"), STAT_Als_RagdollingSceneQueries, STATGROUP_Als, ALS_API)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Floor Queries"), STAT_Als_FloorQueries, STATGROUP_Als, ALS_API)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("RPCs Sent"), STAT_Als_RpcsSent, STATGROUP_Als, ALS_API)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Montages Played"), STAT_Als_MontagesPlayed, STATGROUP_Als, ALS_API)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Saved Move Allocations"), STAT_Als_SavedMoveAllocations, STATGROUP_Als, ALS_API)
+
+// Largest number of saved moves a client has had at the same time, see FAlsNetworkPredictionData.
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Peak Saved Moves"), STAT_Als_PeakSavedMoves, STATGROUP_Als, ALS_API)
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(ALS_API, Als);
+
+/// Increments both the STAT_Als_<Name> counter and the <Name> stat of the "Als" CSV profiler category by one.
+/// Safe to use from any thread, compiles to nothing when both stats and the CSV profiler are disabled.
+#define ALS_INC_COUNTER(Name) \
+	do \
+	{ \
+		INC_DWORD_STAT(STAT_Als_##Name); \
+		CSV_CUSTOM_STAT(Als, Name, 1, ECsvCustomStatOp::Accumulate); \
+	} \
+	while (false)
@@ -0,0 +1,28 @@
+using UnrealBuildTool;
+
+public class ALSBenchmarks : ModuleRules
+{
+	public ALSBenchmarks(ReadOnlyTargetRules target) : base(target)
+	{
+		IncludeOrderVersion = EngineIncludeOrderVersion.Unreal5_8;
+
+		// if (Target.bBuildEditor)
+		// {
+		// 	// Verify that all source files include all required dependencies.
+		//
+		// 	bUseUnity = false;
+		// 	PCHUsage = PCHUsageMode.NoPCHs;
+		// }
+
+		// CppCompileWarningSettings.UnsafeTypeCastWarningLevel = WarningLevel.Warning;
+		CppCompileWarningSettings.NonInlinedGenCppWarningLevel = WarningLevel.Warning;
+
+		PublicDependencyModuleNames.AddRange([
+			"Core", "CoreUObject", "Engine", "GameplayTags", "ALS", "ALSCamera"
+		]);
+
+		PrivateDependencyModuleNames.AddRange([
+			"Json"
+		]);
+	}
+}
@@ -0,0 +1,770 @@
+#include "AlsCrowdBenchmarkSubsystem.h"
+
+#include "AlsCameraComponent.h"
+#include "AlsCharacter.h"
+#include "AlsLedgeIndexSubsystem.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Dom/JsonObject.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/Controller.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Settings/AlsCharacterSettings.h"
+#include "Stats/StatsData.h"
+#include "Utility/AlsGameplayTags.h"
+#include "Utility/AlsLog.h"
+#include "Utility/AlsUtility.h"
+#include "Utility/AlsVector.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsCrowdBenchmarkSubsystem)
+
+namespace AlsCrowdBenchmarkSubsystem
+{
+	static const TCHAR* DefaultCharacterClassPath{TEXT("/ALS/ALS/Character/B_Als_Character.B_Als_Character_C")};
+
+	static const TCHAR* BoxMeshPath{TEXT("/Engine/BasicShapes/Cube.Cube")};
+
+	static constexpr auto CategoriesCount{static_cast<int32>(EAlsCrowdBenchmarkCategory::Count)};
+
+	static constexpr auto LastPhase{EAlsCrowdBenchmarkPhase::Ragdolling};
+
+	// Cycle stats that the category times are taken from, indexed by EAlsCrowdBenchmarkCategory.
+	// The frame time is measured by the subsystem itself, so it has no stat.
+
+	static const TStaticArray<FName, CategoriesCount> CategoryStatNames{
+		FName{},
+		FName{TEXT("STAT_AAlsCharacter_Tick")},
+		FName{TEXT("STAT_CharacterMovement")},
+		FName{TEXT("STAT_UAlsAnimationInstance_NativeUpdateAnimation")},
+		FName{TEXT("STAT_UAlsAnimationInstance_NativeThreadSafeUpdateAnimation")},
+		FName{TEXT("STAT_PerformAnimEvaluation")},
+		FName{TEXT("STAT_AnimGameThreadTime")},
+		FName{TEXT("STAT_UAlsCameraComponent_TickCamera")}
+	};
+
+	static const FName MantlingSceneQueriesStatName{TEXT("STAT_Als_MantlingSceneQueries")};
+
+	ENamedThreads::Type GetStatsThread()
+	{
+		return FPlatformProcess::SupportsMultithreading() ? ENamedThreads::GetStatsThread() : ENamedThreads::GameThread;
+	}
+
+	bool IsMantlingPhase(const EAlsCrowdBenchmarkPhase Phase)
+	{
+		return Phase == EAlsCrowdBenchmarkPhase::JumpingAndMantling || Phase == EAlsCrowdBenchmarkPhase::JumpingAndMantlingWithLedgeIndex;
+	}
+
+	FString GetPhaseName(const EAlsCrowdBenchmarkPhase Phase)
+	{
+		return StaticEnum<EAlsCrowdBenchmarkPhase>()->GetNameStringByValue(static_cast<int64>(Phase));
+	}
+
+	FString GetCategoryName(const int32 Category)
+	{
+		return StaticEnum<EAlsCrowdBenchmarkCategory>()->GetNameStringByValue(Category);
+	}
+}
+
+void FAlsCrowdBenchmarkTiming::AddSample(const double Time)
+{
+	TotalTime += Time;
+	MaxTime = FMath::Max(MaxTime, Time);
+	SamplesCount += 1;
+}
+
+double FAlsCrowdBenchmarkTiming::GetAverageTime() const
+{
+	return SamplesCount > 0 ? TotalTime / SamplesCount : 0.0;
+}
+
+double FAlsCrowdBenchmarkPhaseResult::GetMantlingSceneQueriesPerFrame() const
+{
+	return StatsFramesCount > 0 ? static_cast<double>(MantlingSceneQueriesCount) / StatsFramesCount : 0.0;
+}
+
+bool FAlsCrowdBenchmarkRunResult::IsWithinBudget() const
+{
+	if (FrameTimeBudget < 0.0f)
+	{
+		return true;
+	}
+
+	for (const auto& PhaseResult : Phases)
+	{
+		const auto& FrameTiming{PhaseResult.Timings[static_cast<int32>(EAlsCrowdBenchmarkCategory::Frame)]};
+
+		if (FrameTiming.GetAverageTime() > FrameTimeBudget)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool UAlsCrowdBenchmarkSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return Super::ShouldCreateSubsystem(Outer) && FParse::Param(FCommandLine::Get(), TEXT("AlsBenchmark"));
+}
+
+void UAlsCrowdBenchmarkSubsystem::OnWorldBeginPlay(UWorld& World)
+{
+	Super::OnWorldBeginPlay(World);
+
+	ParseCommandLine();
+
+	if (!IsValid(CharacterClass) || CharactersCounts.IsEmpty())
+	{
+		UE_LOGF(LogAls, Error, "Crowd benchmark can't be started: invalid character class or characters counts.");
+		FPlatformMisc::RequestExitWithStatus(false, 1);
+		return;
+	}
+
+	const auto* CharacterSettings{CharacterClass->GetDefaultObject<AAlsCharacter>()->GetSettings()};
+	bDefaultUseLedgeIndex = IsValid(CharacterSettings) && CharacterSettings->Mantling.bUseLedgeIndex;
+
+	StartStatsCapture();
+
+	// Use a fixed time step so that the simulation is the same regardless of the machine's performance.
+
+	FApp::SetUseFixedTimeStep(true);
+	FApp::SetFixedDeltaTime(FixedDeltaTime);
+
+	StartRun(0);
+}
+
+void UAlsCrowdBenchmarkSubsystem::Deinitialize()
+{
+	StopStatsCapture();
+
+	if (!bFinished && AlsCrowdBenchmarkSubsystem::IsMantlingPhase(Phase))
+	{
+		SetUseLedgeIndex(bDefaultUseLedgeIndex);
+	}
+
+	Characters.Reset();
+
+	Super::Deinitialize();
+}
+
+void UAlsCrowdBenchmarkSubsystem::Tick(const float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (bFinished || !Results.IsValidIndex(RunIndex))
+	{
+		return;
+	}
+
+	const auto Cycles{FPlatformTime::Cycles64()};
+
+	if (PhaseFrame >= WarmUpFramesCount && PreviousFrameCycles > 0)
+	{
+		auto& PhaseResult{Results[RunIndex].Phases.Last()};
+
+		PhaseResult.Timings[static_cast<int32>(EAlsCrowdBenchmarkCategory::Frame)].AddSample(
+			FPlatformTime::ToMilliseconds64(Cycles - PreviousFrameCycles));
+
+		PhaseResult.FramesCount += 1;
+	}
+
+	AddStatsFrames();
+
+	PreviousFrameCycles = Cycles;
+	PhaseFrame += 1;
+
+	if (PhaseFrame >= WarmUpFramesCount + MeasuredFramesCount)
+	{
+		FinishPhase();
+
+		if (bFinished)
+		{
+			return;
+		}
+	}
+
+	// The input is consumed by the characters in the next frame.
+
+	for (auto i{0}; i < Characters.Num(); i++)
+	{
+		auto* Character{Characters[i].Character.Get()};
+		if (IsValid(Character))
+		{
+			ApplyPhaseInput(i, Character);
+		}
+	}
+}
+
+TStatId UAlsCrowdBenchmarkSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAlsCrowdBenchmarkSubsystem, STATGROUP_Tickables)
+}
+
+bool UAlsCrowdBenchmarkSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAlsCrowdBenchmarkSubsystem::ParseCommandLine()
+{
+	const auto* CommandLine{FCommandLine::Get()};
+
+	FString CharacterClassPath{AlsCrowdBenchmarkSubsystem::DefaultCharacterClassPath};
+	FParse::Value(CommandLine, TEXT("AlsBenchmarkCharacterClass="), CharacterClassPath);
+
+	CharacterClass = FSoftClassPath{CharacterClassPath}.TryLoadClass<AAlsCharacter>();
+
+	FString CountsString{TEXT("50,200,500")};
+	FParse::Value(CommandLine, TEXT("AlsBenchmarkCounts="), CountsString, false);
+
+	TArray<FString> Strings;
+	CountsString.ParseIntoArray(Strings, TEXT(","));
+
+	CharactersCounts.Reset();
+
+	for (const auto& String : Strings)
+	{
+		const auto Count{FCString::Atoi(*String)};
+		if (Count > 0)
+		{
+			CharactersCounts.Add(Count);
+		}
+	}
+
+	FString BudgetsString;
+	FParse::Value(CommandLine, TEXT("AlsBenchmarkBudgets="), BudgetsString, false);
+
+	BudgetsString.ParseIntoArray(Strings, TEXT(","));
+
+	FrameTimeBudgets.Reset();
+
+	for (const auto& String : Strings)
+	{
+		FString CountString;
+		FString BudgetString;
+
+		if (String.Split(TEXT(":"), &CountString, &BudgetString))
+		{
+			FrameTimeBudgets.Add(FCString::Atoi(*CountString), FCString::Atof(*BudgetString));
+		}
+	}
+
+	FParse::Value(CommandLine, TEXT("AlsBenchmarkFrames="), MeasuredFramesCount);
+	MeasuredFramesCount = FMath::Max(1, MeasuredFramesCount);
+
+	OutputDirectory = FPaths::ProjectSavedDir() / TEXT("Benchmarks");
+	FParse::Value(CommandLine, TEXT("AlsBenchmarkOutput="), OutputDirectory);
+}
+
+void UAlsCrowdBenchmarkSubsystem::StartStatsCapture()
+{
+#if STATS
+	StatsPrimaryEnableAdd();
+	bCapturingStats = true;
+
+	// The stats thread state can only be accessed from the stats thread.
+
+	FSimpleDelegateGraphTask::CreateAndDispatchWhenReady(FSimpleDelegate::CreateLambda([this]
+	{
+		NewStatsFrameDelegateHandle = FStatsThreadState::GetLocalState().NewFrameDelegate.AddRaw(this, &ThisClass::OnNewStatsFrame);
+	}), TStatId{}, nullptr, AlsCrowdBenchmarkSubsystem::GetStatsThread());
+#else
+	UE_LOGF(LogAls, Warning, "Crowd benchmark: stats are disabled in this build, only the frame time will be measured.");
+#endif
+}
+
+void UAlsCrowdBenchmarkSubsystem::StopStatsCapture()
+{
+#if STATS
+	if (!bCapturingStats)
+	{
+		return;
+	}
+
+	bCapturingStats = false;
+
+	const auto Task{
+		FSimpleDelegateGraphTask::CreateAndDispatchWhenReady(FSimpleDelegate::CreateLambda([this]
+		{
+			FStatsThreadState::GetLocalState().NewFrameDelegate.Remove(NewStatsFrameDelegateHandle);
+		}), TStatId{}, nullptr, AlsCrowdBenchmarkSubsystem::GetStatsThread())
+	};
+
+	// Make sure that the delegate is no longer executed once this subsystem is destroyed.
+
+	FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
+
+	StatsPrimaryEnableSubtract();
+#endif
+}
+
+void UAlsCrowdBenchmarkSubsystem::OnNewStatsFrame(const int64 Frame)
+{
+#if STATS
+	TArray<FStatMessage> Messages;
+	FStatsThreadState::GetLocalState().GetInclusiveAggregateStackStats(Frame, Messages);
+
+	FAlsCrowdBenchmarkStatsFrame StatsFrame;
+
+	for (const auto& Message : Messages)
+	{
+		const auto StatName{Message.NameAndInfo.GetShortName()};
+		const auto Category{AlsCrowdBenchmarkSubsystem::CategoryStatNames.IndexOfByKey(StatName)};
+
+		if (Category > static_cast<int32>(EAlsCrowdBenchmarkCategory::Frame) && Message.NameAndInfo.GetFlag(EStatMetaFlags::IsCycle))
+		{
+			StatsFrame.Times[Category] = FPlatformTime::ToMilliseconds(Message.GetValue_Duration());
+		}
+		else if (StatName == AlsCrowdBenchmarkSubsystem::MantlingSceneQueriesStatName)
+		{
+			StatsFrame.MantlingSceneQueriesCount = static_cast<int32>(Message.GetValue_int64());
+		}
+	}
+
+	FScopeLock Lock{&StatsFramesLock};
+	PendingStatsFrames.Add(StatsFrame);
+#endif
+}
+
+void UAlsCrowdBenchmarkSubsystem::AddStatsFrames()
+{
+	TArray<FAlsCrowdBenchmarkStatsFrame> StatsFrames;
+
+	{
+		FScopeLock Lock{&StatsFramesLock};
+		Swap(StatsFrames, PendingStatsFrames);
+	}
+
+	if (PhaseFrame < WarmUpFramesCount || !Results.IsValidIndex(RunIndex))
+	{
+		return;
+	}
+
+	auto& PhaseResult{Results[RunIndex].Phases.Last()};
+
+	for (const auto& StatsFrame : StatsFrames)
+	{
+		for (auto i{static_cast<int32>(EAlsCrowdBenchmarkCategory::CharacterTick)}; i < AlsCrowdBenchmarkSubsystem::CategoriesCount; i++)
+		{
+			PhaseResult.Timings[i].AddSample(StatsFrame.Times[i]);
+		}
+
+		PhaseResult.StatsFramesCount += 1;
+		PhaseResult.MantlingSceneQueriesCount += StatsFrame.MantlingSceneQueriesCount;
+	}
+}
+
+void UAlsCrowdBenchmarkSubsystem::StartRun(const int32 NewRunIndex)
+{
+	RunIndex = NewRunIndex;
+
+	const auto CharactersCount{CharactersCounts[RunIndex]};
+	const auto* FrameTimeBudget{FrameTimeBudgets.Find(CharactersCount)};
+
+	auto& RunResult{Results.Emplace_GetRef()};
+	RunResult.CharactersCount = CharactersCount;
+	RunResult.FrameTimeBudget = FrameTimeBudget != nullptr ? *FrameTimeBudget : -1.0f;
+
+	SpawnCharacters(CharactersCount);
+	StartPhase(EAlsCrowdBenchmarkPhase::Idle);
+}
+
+void UAlsCrowdBenchmarkSubsystem::StartPhase(const EAlsCrowdBenchmarkPhase NewPhase)
+{
+	Phase = NewPhase;
+	PhaseFrame = 0;
+	PreviousFrameCycles = 0;
+
+	Results[RunIndex].Phases.Emplace_GetRef().Phase = Phase;
+
+	const auto bMantling{AlsCrowdBenchmarkSubsystem::IsMantlingPhase(Phase)};
+
+	if (bMantling)
+	{
+		SetUseLedgeIndex(Phase == EAlsCrowdBenchmarkPhase::JumpingAndMantlingWithLedgeIndex);
+	}
+
+	auto* LedgeIndex{GetWorld()->GetSubsystem<UAlsLedgeIndexSubsystem>()};
+
+	for (auto& BenchmarkCharacter : Characters)
+	{
+		auto* Character{BenchmarkCharacter.Character.Get()};
+		if (!IsValid(Character))
+		{
+			continue;
+		}
+
+		Character->TeleportTo(BenchmarkCharacter.SpawnLocation, FRotator::ZeroRotator, false, true);
+		Character->GetCharacterMovement()->StopMovementImmediately();
+
+		const auto bMoving{Phase == EAlsCrowdBenchmarkPhase::WalkingCircles || Phase == EAlsCrowdBenchmarkPhase::Sprinting || bMantling};
+
+		Character->SetDesiredRotationMode(bMoving ? AlsRotationModeTags::VelocityDirection : AlsRotationModeTags::ViewDirection);
+
+		switch (Phase)
+		{
+			case EAlsCrowdBenchmarkPhase::WalkingCircles:
+				Character->SetDesiredGait(AlsGaitTags::Walking);
+				break;
+
+			case EAlsCrowdBenchmarkPhase::Sprinting:
+				Character->SetDesiredGait(AlsGaitTags::Sprinting);
+				break;
+
+			case EAlsCrowdBenchmarkPhase::JumpingAndMantling:
+			case EAlsCrowdBenchmarkPhase::JumpingAndMantlingWithLedgeIndex:
+				Character->SetDesiredGait(AlsGaitTags::Running);
+
+				// A static obstacle in front of each character to mantle onto, so that it can be added to the ledge index.
+
+				BenchmarkCharacter.Obstacle = SpawnBox(BenchmarkCharacter.SpawnLocation + FVector{250.0f, 0.0f, 0.0f},
+				                                       {0.5f, 1.5f, 1.0f}, EComponentMobility::Static);
+
+				if (IsValid(LedgeIndex) && BenchmarkCharacter.Obstacle.IsValid())
+				{
+					LedgeIndex->AddPrimitive(BenchmarkCharacter.Obstacle->FindComponentByClass<UStaticMeshComponent>());
+				}
+				break;
+
+			case EAlsCrowdBenchmarkPhase::Ragdolling:
+				Character->SetDesiredGait(AlsGaitTags::Running);
+				Character->StartRagdolling();
+				break;
+
+			default:
+				Character->SetDesiredGait(AlsGaitTags::Running);
+				break;
+		}
+	}
+}
+
+void UAlsCrowdBenchmarkSubsystem::FinishPhase()
+{
+	auto* LedgeIndex{GetWorld()->GetSubsystem<UAlsLedgeIndexSubsystem>()};
+
+	for (auto& BenchmarkCharacter : Characters)
+	{
+		auto* Character{BenchmarkCharacter.Character.Get()};
+		if (IsValid(Character) && Phase == EAlsCrowdBenchmarkPhase::Ragdolling)
+		{
+			Character->StopRagdolling();
+		}
+
+		if (BenchmarkCharacter.Obstacle.IsValid())
+		{
+			if (IsValid(LedgeIndex))
+			{
+				LedgeIndex->RemovePrimitive(BenchmarkCharacter.Obstacle->FindComponentByClass<UStaticMeshComponent>());
+			}
+
+			BenchmarkCharacter.Obstacle->Destroy();
+			BenchmarkCharacter.Obstacle.Reset();
+		}
+	}
+
+	const auto& PhaseResult{Results[RunIndex].Phases.Last()};
+	const auto& FrameTiming{PhaseResult.Timings[static_cast<int32>(EAlsCrowdBenchmarkCategory::Frame)]};
+
+	UE_LOGF(LogAls, Log, "Crowd benchmark: %d characters, %ls phase, average frame time %.3f ms, max frame time %.3f ms, "
+	        "%.2f mantling scene queries per frame.", Results[RunIndex].CharactersCount, *AlsCrowdBenchmarkSubsystem::GetPhaseName(Phase),
+	        FrameTiming.GetAverageTime(), FrameTiming.MaxTime, PhaseResult.GetMantlingSceneQueriesPerFrame());
+
+	if (Phase == EAlsCrowdBenchmarkPhase::JumpingAndMantlingWithLedgeIndex)
+	{
+		SetUseLedgeIndex(bDefaultUseLedgeIndex);
+	}
+
+	if (Phase != AlsCrowdBenchmarkSubsystem::LastPhase)
+	{
+		StartPhase(static_cast<EAlsCrowdBenchmarkPhase>(static_cast<uint8>(Phase) + 1));
+	}
+	else if (CharactersCounts.IsValidIndex(RunIndex + 1))
+	{
+		StartRun(RunIndex + 1);
+	}
+	else
+	{
+		Finish();
+	}
+}
+
+void UAlsCrowdBenchmarkSubsystem::SpawnCharacters(const int32 Count)
+{
+	DestroyCharacters();
+
+	const auto GridSize{FMath::CeilToInt(FMath::Sqrt(static_cast<float>(Count)))};
+	const auto GridExtent{GridSize * CharactersSpacing};
+
+	// Spawn the floor high above the map so that the map's geometry doesn't affect the results.
+
+	Floor = SpawnBox({0.0f, 0.0f, SpawnHeight - 100.0f}, {GridExtent / 100.0f + 10.0f, GridExtent / 100.0f + 10.0f, 1.0f},
+	                 EComponentMobility::Movable);
+
+	const auto* CharacterDefault{CharacterClass->GetDefaultObject<AAlsCharacter>()};
+	const auto CapsuleHalfHeight{CharacterDefault->GetCapsuleComponent()->GetScaledCapsuleHalfHeight()};
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	Characters.Reserve(Count);
+
+	for (auto i{0}; i < Count; i++)
+	{
+		const FVector SpawnLocation{
+			((i % GridSize) + 0.5f) * CharactersSpacing - GridExtent * 0.5f,
+			((i / GridSize) + 0.5f) * CharactersSpacing - GridExtent * 0.5f,
+			SpawnHeight + CapsuleHalfHeight + 2.0f
+		};
+
+		auto* Character{GetWorld()->SpawnActor<AAlsCharacter>(CharacterClass, SpawnLocation, FRotator::ZeroRotator, SpawnParameters)};
+		if (!IsValid(Character))
+		{
+			continue;
+		}
+
+		// The characters are driven only by the benchmark, so detach them from their controllers and let them move without one.
+
+		if (IsValid(Character->GetController()))
+		{
+			Character->GetController()->UnPossess();
+		}
+
+		Character->GetCharacterMovement()->bRunPhysicsWithNoController = true;
+
+		auto& BenchmarkCharacter{Characters.Emplace_GetRef()};
+		BenchmarkCharacter.Character = Character;
+		BenchmarkCharacter.SpawnLocation = SpawnLocation;
+		BenchmarkCharacter.Camera = Character->FindComponentByClass<UAlsCameraComponent>();
+
+		// The camera only ticks while it's used by a player, so enable its tick to include it in the measurements.
+
+		if (BenchmarkCharacter.Camera.IsValid())
+		{
+			BenchmarkCharacter.Camera->SetComponentTickEnabled(true);
+		}
+	}
+}
+
+void UAlsCrowdBenchmarkSubsystem::DestroyCharacters()
+{
+	for (auto& BenchmarkCharacter : Characters)
+	{
+		if (BenchmarkCharacter.Character.IsValid())
+		{
+			BenchmarkCharacter.Character->Destroy();
+		}
+
+		if (BenchmarkCharacter.Obstacle.IsValid())
+		{
+			BenchmarkCharacter.Obstacle->Destroy();
+		}
+	}
+
+	Characters.Reset();
+
+	if (Floor.IsValid())
+	{
+		Floor->Destroy();
+		Floor.Reset();
+	}
+}
+
+AActor* UAlsCrowdBenchmarkSubsystem::SpawnBox(const FVector& Location, const FVector& Scale, const EComponentMobility::Type Mobility) const
+{
+	auto* Mesh{LoadObject<UStaticMesh>(nullptr, AlsCrowdBenchmarkSubsystem::BoxMeshPath)};
+	if (!IsValid(Mesh))
+	{
+		return nullptr;
+	}
+
+	// The box mesh is 100 units in size and has its pivot at the center, so offset it to place its bottom at the location.
+
+	const FTransform Transform{FRotator::ZeroRotator, Location + FVector{0.0f, 0.0f, Scale.Z * 50.0f}, Scale};
+
+	auto* Box{
+		GetWorld()->SpawnActorDeferred<AStaticMeshActor>(AStaticMeshActor::StaticClass(), Transform, nullptr, nullptr,
+		                                                 ESpawnActorCollisionHandlingMethod::AlwaysSpawn)
+	};
+
+	if (IsValid(Box))
+	{
+		// The mesh of a static component can only be changed before the component is registered.
+
+		Box->GetStaticMeshComponent()->SetMobility(Mobility);
+		Box->GetStaticMeshComponent()->SetStaticMesh(Mesh);
+		Box->FinishSpawning(Transform);
+	}
+
+	return Box;
+}
+
+void UAlsCrowdBenchmarkSubsystem::SetUseLedgeIndex(const bool bUseLedgeIndex) const
+{
+	// The settings are a shared asset, so this affects all characters, which is what the benchmark
+	// needs. The original value is restored after the ledge index phase to leave the asset as it was.
+
+	auto* CharacterSettings{const_cast<UAlsCharacterSettings*>(CharacterClass->GetDefaultObject<AAlsCharacter>()->GetSettings())};
+	if (IsValid(CharacterSettings))
+	{
+		CharacterSettings->Mantling.bUseLedgeIndex = bUseLedgeIndex;
+	}
+}
+
+void UAlsCrowdBenchmarkSubsystem::ApplyPhaseInput(const int32 CharacterIndex, AAlsCharacter* Character) const
+{
+	// Offset the movement patterns of the characters so that they don't move in sync.
+
+	const auto Time{static_cast<float>(PhaseFrame * FixedDeltaTime)};
+	const auto AngleOffset{CharacterIndex * 37.0f};
+
+	// When jumping and mantling, move back and forth over the obstacle and jump periodically.
+
+	const auto bMovingForward{(PhaseFrame / MovementDirectionChangeInterval) % 2 == 0};
+	const auto JumpFrame{(PhaseFrame + CharacterIndex) % JumpInterval};
+
+	switch (Phase)
+	{
+		case EAlsCrowdBenchmarkPhase::WalkingCircles:
+			Character->AddMovementInput(UAlsVector::AngleToDirectionXY(AngleOffset + Time * 60.0f), 1.0f, true);
+			break;
+
+		case EAlsCrowdBenchmarkPhase::Sprinting:
+			Character->AddMovementInput(UAlsVector::AngleToDirectionXY(AngleOffset + Time * 90.0f), 1.0f, true);
+			break;
+
+		case EAlsCrowdBenchmarkPhase::JumpingAndMantling:
+		case EAlsCrowdBenchmarkPhase::JumpingAndMantlingWithLedgeIndex:
+			Character->AddMovementInput(bMovingForward ? FVector::ForwardVector : FVector::BackwardVector, 1.0f, true);
+
+			if (JumpFrame == 0)
+			{
+				Character->Jump();
+			}
+			else if (JumpFrame == 1)
+			{
+				Character->StopJumping();
+			}
+			break;
+
+		default:
+			break;
+	}
+}
+
+void UAlsCrowdBenchmarkSubsystem::Finish()
+{
+	bFinished = true;
+
+	DestroyCharacters();
+
+	const auto bReportsWritten{WriteReports()};
+
+	auto bWithinBudget{true};
+
+	for (const auto& RunResult : Results)
+	{
+		if (!RunResult.IsWithinBudget())
+		{
+			UE_LOGF(LogAls, Error, "Crowd benchmark: frame time budget of %.3f ms exceeded with %d characters.",
+			        RunResult.FrameTimeBudget, RunResult.CharactersCount);
+
+			bWithinBudget = false;
+		}
+	}
+
+	FPlatformMisc::RequestExitWithStatus(false, bReportsWritten && bWithinBudget ? 0 : 1);
+}
+
+bool UAlsCrowdBenchmarkSubsystem::WriteReports() const
+{
+	TStringBuilder<4096> Csv;
+	Csv << TEXT("CharactersCount,Phase,FramesCount");
+
+	for (auto i{0}; i < AlsCrowdBenchmarkSubsystem::CategoriesCount; i++)
+	{
+		const auto CategoryName{AlsCrowdBenchmarkSubsystem::GetCategoryName(i)};
+		Csv << TEXT(',') << CategoryName << TEXT("AverageMs,") << CategoryName << TEXT("MaxMs");
+	}
+
+	Csv << TEXT(",MantlingSceneQueriesPerFrame\n");
+
+	TArray<TSharedPtr<FJsonValue>> RunsJson;
+
+	for (const auto& RunResult : Results)
+	{
+		auto RunJson{MakeShared<FJsonObject>()};
+		RunJson->SetNumberField(TEXT("CharactersCount"), RunResult.CharactersCount);
+
+		if (RunResult.FrameTimeBudget >= 0.0f)
+		{
+			RunJson->SetNumberField(TEXT("FrameTimeBudgetMs"), RunResult.FrameTimeBudget);
+		}
+
+		RunJson->SetBoolField(TEXT("WithinBudget"), RunResult.IsWithinBudget());
+
+		TArray<TSharedPtr<FJsonValue>> PhasesJson;
+
+		for (const auto& PhaseResult : RunResult.Phases)
+		{
+			const auto PhaseName{AlsCrowdBenchmarkSubsystem::GetPhaseName(PhaseResult.Phase)};
+
+			Csv << RunResult.CharactersCount << TEXT(',') << PhaseName << TEXT(',') << PhaseResult.FramesCount;
+
+			auto PhaseJson{MakeShared<FJsonObject>()};
+			PhaseJson->SetStringField(TEXT("Phase"), PhaseName);
+			PhaseJson->SetNumberField(TEXT("FramesCount"), PhaseResult.FramesCount);
+
+			for (auto i{0}; i < AlsCrowdBenchmarkSubsystem::CategoriesCount; i++)
+			{
+				const auto& Timing{PhaseResult.Timings[i]};
+				const auto AverageTime{Timing.GetAverageTime()};
+
+				Csv.Appendf(TEXT(",%.4f,%.4f"), AverageTime, Timing.MaxTime);
+
+				auto TimingJson{MakeShared<FJsonObject>()};
+				TimingJson->SetNumberField(TEXT("AverageMs"), AverageTime);
+				TimingJson->SetNumberField(TEXT("MaxMs"), Timing.MaxTime);
+
+				PhaseJson->SetObjectField(AlsCrowdBenchmarkSubsystem::GetCategoryName(i), TimingJson);
+			}
+
+			Csv.Appendf(TEXT(",%.2f\n"), PhaseResult.GetMantlingSceneQueriesPerFrame());
+
+			PhaseJson->SetNumberField(TEXT("MantlingSceneQueriesPerFrame"), PhaseResult.GetMantlingSceneQueriesPerFrame());
+
+			PhasesJson.Emplace(MakeShared<FJsonValueObject>(PhaseJson));
+		}
+
+		RunJson->SetArrayField(TEXT("Phases"), PhasesJson);
+		RunsJson.Emplace(MakeShared<FJsonValueObject>(RunJson));
+	}
+
+	auto ReportJson{MakeShared<FJsonObject>()};
+	ReportJson->SetStringField(TEXT("CharacterClass"), GetPathNameSafe(CharacterClass));
+	ReportJson->SetNumberField(TEXT("FixedDeltaTime"), FixedDeltaTime);
+	ReportJson->SetArrayField(TEXT("Runs"), RunsJson);
+
+	FString Json;
+	FJsonSerializer::Serialize(ReportJson, TJsonWriterFactory<>::Create(&Json));
+
+	const auto CsvPath{OutputDirectory / TEXT("AlsCrowdBenchmark.csv")};
+	const auto JsonPath{OutputDirectory / TEXT("AlsCrowdBenchmark.json")};
+
+	if (!FFileHelper::SaveStringToFile(Csv.ToView(), *CsvPath) || !FFileHelper::SaveStringToFile(Json, *JsonPath))
+	{
+		UE_LOGF(LogAls, Error, "Crowd benchmark: failed to write the reports to %ls.", *OutputDirectory);
+		return false;
+	}
+
+	UE_LOGF(LogAls, Log, "Crowd benchmark: reports written to %ls and %ls.", *CsvPath, *JsonPath);
+	return true;
+}
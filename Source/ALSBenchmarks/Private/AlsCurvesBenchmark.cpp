@@ -0,0 +1,165 @@
+#include "Curves/CurveFloat.h"
+#include "Curves/CurveVector.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Settings/AlsAnimationInstanceSettings.h"
+#include "Settings/AlsMovementSettings.h"
+#include "UObject/UObjectIterator.h"
+#include "Utility/AlsLog.h"
+
+// Compares the baked curves of all loaded movement and animation instance settings with their source curves. Reports the
+// maximum error and the evaluation throughput of each curve, and warns about curves that aren't baked. Curves with a
+// non-constant extrapolation are noted, since their baked curves evaluate the source curve outside the key range.
+// Usage: Als.Benchmark.Curves [EvaluationsCount]
+
+namespace AlsCurvesBenchmark
+{
+	// Fraction of the key range that is also evaluated before and after it.
+	static constexpr auto ExtrapolationRange{0.1f};
+
+	void ReportCurve(const UObject& Settings, const FString& CurveName, const FRichCurve& Curve,
+	                 const FAlsBakedCurve& BakedCurve, const int32 EvaluationsCount)
+	{
+		if (!BakedCurve.bBaked)
+		{
+			UE_LOGF(LogAls, Warning, "Curves benchmark: %ls: %ls: the curve isn't baked.", *Settings.GetName(), *CurveName);
+			return;
+		}
+
+		if (!BakedCurve.bConstantExtrapolation)
+		{
+			UE_LOGF(LogAls, Log, "Curves benchmark: %ls: %ls: the curve uses a non-constant extrapolation, "
+			        "so it's evaluated instead of the baked curve outside the key range.", *Settings.GetName(), *CurveName);
+		}
+
+		auto MinTime{0.0f};
+		auto MaxTime{0.0f};
+		Curve.GetTimeRange(MinTime, MaxTime);
+
+		const auto StartTime{MinTime - (MaxTime - MinTime) * ExtrapolationRange};
+		const auto TimeStep{(MaxTime - MinTime) * (1.0f + 2.0f * ExtrapolationRange) / EvaluationsCount};
+
+		// The sums of the values are logged so that the evaluations can't be optimized away.
+
+		auto CurveSum{0.0};
+		const auto CurveStartTime{FPlatformTime::Seconds()};
+
+		for (auto i{0}; i < EvaluationsCount; i++)
+		{
+			CurveSum += Curve.Eval(StartTime + TimeStep * i);
+		}
+
+		const auto CurveTime{FPlatformTime::Seconds() - CurveStartTime};
+
+		auto BakedSum{0.0};
+		const auto BakedStartTime{FPlatformTime::Seconds()};
+
+		for (auto i{0}; i < EvaluationsCount; i++)
+		{
+			BakedSum += BakedCurve.Evaluate(StartTime + TimeStep * i, &Curve);
+		}
+
+		const auto BakedTime{FPlatformTime::Seconds() - BakedStartTime};
+
+		UE_LOGF(LogAls, Log, "Curves benchmark: %ls: %ls: %d keys, max error %g, average value %g (baked %g), "
+		        "curve %.1f M/s, baked %.1f M/s (%.2fx).", *Settings.GetName(), *CurveName, Curve.GetNumKeys(),
+		        BakedCurve.CalculateMaxError(Curve), CurveSum / EvaluationsCount, BakedSum / EvaluationsCount,
+		        EvaluationsCount / CurveTime * 1e-6, EvaluationsCount / BakedTime * 1e-6, CurveTime / BakedTime);
+	}
+
+	void ReportCurve(const UObject& Settings, const FString& CurveName, const UCurveFloat* Curve,
+	                 const FAlsBakedCurve& BakedCurve, const int32 EvaluationsCount)
+	{
+		if (IsValid(Curve))
+		{
+			ReportCurve(Settings, CurveName, Curve->FloatCurve, BakedCurve, EvaluationsCount);
+		}
+	}
+
+	void ReportMovementSettings(const UAlsMovementSettings& Settings, const int32 EvaluationsCount)
+	{
+		for (const auto& RotationMode : Settings.RotationModes)
+		{
+			for (const auto& Stance : RotationMode.Value.Stances)
+			{
+				const auto& GaitSettings{Stance.Value};
+				const auto Prefix{FString::Printf(TEXT("%s %s "), *RotationMode.Key.ToString(), *Stance.Key.ToString())};
+
+				if (IsValid(GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve))
+				{
+					const auto& FloatCurves{GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves};
+
+					ReportCurve(Settings, Prefix + TEXT("Acceleration"), FloatCurves[0],
+					            GaitSettings.AccelerationBakedCurve, EvaluationsCount);
+
+					ReportCurve(Settings, Prefix + TEXT("Deceleration"), FloatCurves[1],
+					            GaitSettings.DecelerationBakedCurve, EvaluationsCount);
+
+					ReportCurve(Settings, Prefix + TEXT("GroundFriction"), FloatCurves[2],
+					            GaitSettings.GroundFrictionBakedCurve, EvaluationsCount);
+				}
+
+				ReportCurve(Settings, Prefix + TEXT("RotationInterpolationSpeed"), GaitSettings.RotationInterpolationSpeedCurve,
+				            GaitSettings.RotationInterpolationSpeedBakedCurve, EvaluationsCount);
+			}
+		}
+	}
+
+	void ReportAnimationInstanceSettings(const UAlsAnimationInstanceSettings& Settings, const int32 EvaluationsCount)
+	{
+		ReportCurve(Settings, TEXT("Grounded.RotationYawOffsetForward"), Settings.Grounded.RotationYawOffsetForwardCurve,
+		            Settings.Grounded.RotationYawOffsetForwardBakedCurve, EvaluationsCount);
+
+		ReportCurve(Settings, TEXT("Grounded.RotationYawOffsetBackward"), Settings.Grounded.RotationYawOffsetBackwardCurve,
+		            Settings.Grounded.RotationYawOffsetBackwardBakedCurve, EvaluationsCount);
+
+		ReportCurve(Settings, TEXT("Grounded.RotationYawOffsetLeft"), Settings.Grounded.RotationYawOffsetLeftCurve,
+		            Settings.Grounded.RotationYawOffsetLeftBakedCurve, EvaluationsCount);
+
+		ReportCurve(Settings, TEXT("Grounded.RotationYawOffsetRight"), Settings.Grounded.RotationYawOffsetRightCurve,
+		            Settings.Grounded.RotationYawOffsetRightBakedCurve, EvaluationsCount);
+
+		ReportCurve(Settings, TEXT("Standing.StrideBlendAmountWalk"), Settings.Standing.StrideBlendAmountWalkCurve,
+		            Settings.Standing.StrideBlendAmountWalkBakedCurve, EvaluationsCount);
+
+		ReportCurve(Settings, TEXT("Standing.StrideBlendAmountRun"), Settings.Standing.StrideBlendAmountRunCurve,
+		            Settings.Standing.StrideBlendAmountRunBakedCurve, EvaluationsCount);
+
+		ReportCurve(Settings, TEXT("Crouching.StrideBlendAmount"), Settings.Crouching.StrideBlendAmountCurve,
+		            Settings.Crouching.StrideBlendAmountBakedCurve, EvaluationsCount);
+
+		ReportCurve(Settings, TEXT("InAir.LeanAmount"), Settings.InAir.LeanAmountCurve,
+		            Settings.InAir.LeanAmountBakedCurve, EvaluationsCount);
+
+		ReportCurve(Settings, TEXT("InAir.GroundPredictionAmount"), Settings.InAir.GroundPredictionAmountCurve,
+		            Settings.InAir.GroundPredictionAmountBakedCurve, EvaluationsCount);
+	}
+
+	void Run(const TArray<FString>& Arguments)
+	{
+		const auto EvaluationsCount{Arguments.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Arguments[0])) : 100000};
+
+		auto SettingsCount{0};
+
+		for (TObjectIterator<UAlsMovementSettings> Iterator; Iterator; ++Iterator)
+		{
+			ReportMovementSettings(**Iterator, EvaluationsCount);
+			SettingsCount += 1;
+		}
+
+		for (TObjectIterator<UAlsAnimationInstanceSettings> Iterator; Iterator; ++Iterator)
+		{
+			ReportAnimationInstanceSettings(**Iterator, EvaluationsCount);
+			SettingsCount += 1;
+		}
+
+		UE_LOGF(LogAls, Log, "Curves benchmark: %d settings assets checked.", SettingsCount);
+	}
+
+	static FAutoConsoleCommand Command{
+		TEXT("Als.Benchmark.Curves"),
+		TEXT("Compares the baked curves of all loaded ALS movement and animation instance settings with their source curves. ")
+		TEXT("Usage: Als.Benchmark.Curves [EvaluationsCount]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&Run)
+	};
+}
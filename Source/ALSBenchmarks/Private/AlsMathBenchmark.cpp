@@ -0,0 +1,254 @@
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Utility/AlsLog.h"
+#include "Utility/AlsMath.h"
+#include "Utility/AlsRotation.h"
+
+// Compares throughput and accuracy of the batched UAlsMath and UAlsRotation damper and spring functions with their
+// scalar versions. Usage: Als.Benchmark.Math [ValuesCount] [IterationsCount]
+
+namespace AlsMathBenchmark
+{
+	static constexpr auto DeltaTime{1.0f / 60.0f};
+
+	static constexpr auto HalfLife{0.1f};
+
+	static constexpr auto SpringFrequency{1.5f};
+
+	static constexpr auto SpringDampingRatio{0.5f};
+
+	template <typename FunctionType>
+	double MeasureTime(const int32 IterationsCount, FunctionType&& Function)
+	{
+		const auto StartTime{FPlatformTime::Seconds()};
+
+		for (auto i{0}; i < IterationsCount; i++)
+		{
+			Function();
+		}
+
+		return FPlatformTime::Seconds() - StartTime;
+	}
+
+	float CalculateMaxError(const TConstArrayView<float> Values, const TConstArrayView<float> ReferenceValues)
+	{
+		auto MaxError{0.0f};
+
+		for (auto i{0}; i < Values.Num(); i++)
+		{
+			MaxError = FMath::Max(MaxError, FMath::Abs(Values[i] - ReferenceValues[i]));
+		}
+
+		return MaxError;
+	}
+
+	void LogResult(const TCHAR* Name, const int64 ValuesCount, const double ScalarTime, const double BatchTime, const float MaxError)
+	{
+		UE_LOGF(LogAls, Log, "Math benchmark: %ls: scalar %.1f M/s, batch %.1f M/s (%.2fx), max difference %g.",
+		        Name, ValuesCount / ScalarTime * 1e-6, ValuesCount / BatchTime * 1e-6, ScalarTime / BatchTime, MaxError);
+	}
+
+	void Run(const TArray<FString>& Arguments)
+	{
+		const auto ValuesCount{Arguments.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Arguments[0])) : 1024};
+		const auto IterationsCount{Arguments.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Arguments[1])) : 1000};
+		const auto TotalValuesCount{static_cast<int64>(ValuesCount) * IterationsCount};
+
+		FRandomStream Random{0};
+
+		TArray<float> InitialValues;
+		TArray<float> Targets;
+		TArray<float> HalfLives;
+
+		InitialValues.SetNumUninitialized(ValuesCount);
+		Targets.SetNumUninitialized(ValuesCount);
+		HalfLives.SetNumUninitialized(ValuesCount);
+
+		for (auto i{0}; i < ValuesCount; i++)
+		{
+			InitialValues[i] = Random.FRandRange(-180.0f, 180.0f);
+			Targets[i] = Random.FRandRange(-180.0f, 180.0f);
+			HalfLives[i] = Random.FRandRange(0.02f, 0.5f);
+		}
+
+		TArray<float> ScalarValues;
+		TArray<float> BatchValues;
+
+		// Damper with the same half-life for all values.
+
+		ScalarValues = InitialValues;
+		BatchValues = InitialValues;
+
+		for (auto i{0}; i < ValuesCount; i++)
+		{
+			ScalarValues[i] = UAlsMath::DamperExact(ScalarValues[i], Targets[i], DeltaTime, HalfLife);
+		}
+
+		UAlsMath::DamperExactBatch(BatchValues, Targets, DeltaTime, HalfLife);
+
+		auto MaxError{CalculateMaxError(BatchValues, ScalarValues)};
+
+		auto ScalarTime{
+			MeasureTime(IterationsCount, [&]
+			{
+				for (auto i{0}; i < ValuesCount; i++)
+				{
+					ScalarValues[i] = UAlsMath::DamperExact(ScalarValues[i], Targets[i], DeltaTime, HalfLife);
+				}
+			})
+		};
+
+		auto BatchTime{
+			MeasureTime(IterationsCount, [&]
+			{
+				UAlsMath::DamperExactBatch(BatchValues, Targets, DeltaTime, HalfLife);
+			})
+		};
+
+		LogResult(TEXT("DamperExact"), TotalValuesCount, ScalarTime, BatchTime, MaxError);
+
+		// Damper with a separate half-life for each value.
+
+		for (const auto bFastApproximation : {false, true})
+		{
+			ScalarValues = InitialValues;
+			BatchValues = InitialValues;
+
+			ScalarTime = MeasureTime(IterationsCount, [&]
+			{
+				for (auto i{0}; i < ValuesCount; i++)
+				{
+					ScalarValues[i] = UAlsMath::DamperExact(ScalarValues[i], Targets[i], DeltaTime, HalfLives[i]);
+				}
+			});
+
+			BatchTime = MeasureTime(IterationsCount, [&]
+			{
+				UAlsMath::DamperExactBatch(BatchValues, Targets, HalfLives, DeltaTime, bFastApproximation);
+			});
+
+			LogResult(bFastApproximation ? TEXT("DamperExact (Per Value Half-Life, Fast)") : TEXT("DamperExact (Per Value Half-Life)"),
+			          TotalValuesCount, ScalarTime, BatchTime, CalculateMaxError(BatchValues, ScalarValues));
+		}
+
+		// Spring damper.
+
+		TArray<FAlsSpringFloatState> SpringStates;
+		SpringStates.SetNum(ValuesCount);
+
+		TArray<float> Velocities;
+		Velocities.SetNumZeroed(ValuesCount);
+
+		auto PreviousTargets{InitialValues};
+
+		for (auto i{0}; i < ValuesCount; i++)
+		{
+			SpringStates[i].PreviousTarget = InitialValues[i];
+			SpringStates[i].bStateValid = true;
+		}
+
+		ScalarValues = InitialValues;
+		BatchValues = InitialValues;
+
+		for (auto i{0}; i < ValuesCount; i++)
+		{
+			ScalarValues[i] = UAlsMath::SpringDamper(SpringStates[i], ScalarValues[i], Targets[i],
+			                                         DeltaTime, SpringFrequency, SpringDampingRatio);
+		}
+
+		UAlsMath::SpringDamperBatch(BatchValues, Velocities, PreviousTargets, Targets, DeltaTime, SpringFrequency, SpringDampingRatio);
+
+		MaxError = CalculateMaxError(BatchValues, ScalarValues);
+
+		ScalarTime = MeasureTime(IterationsCount, [&]
+		{
+			for (auto i{0}; i < ValuesCount; i++)
+			{
+				ScalarValues[i] = UAlsMath::SpringDamper(SpringStates[i], ScalarValues[i], Targets[i],
+				                                         DeltaTime, SpringFrequency, SpringDampingRatio);
+			}
+		});
+
+		BatchTime = MeasureTime(IterationsCount, [&]
+		{
+			UAlsMath::SpringDamperBatch(BatchValues, Velocities, PreviousTargets, Targets,
+			                            DeltaTime, SpringFrequency, SpringDampingRatio);
+		});
+
+		LogResult(TEXT("SpringDamper"), TotalValuesCount, ScalarTime, BatchTime, MaxError);
+
+		// Angle damper.
+
+		ScalarValues = InitialValues;
+		BatchValues = InitialValues;
+
+		for (auto i{0}; i < ValuesCount; i++)
+		{
+			ScalarValues[i] = UAlsRotation::DamperExactAngle(ScalarValues[i], Targets[i], DeltaTime, HalfLife);
+		}
+
+		UAlsRotation::DamperExactAngleBatch(BatchValues, Targets, DeltaTime, HalfLife);
+
+		MaxError = CalculateMaxError(BatchValues, ScalarValues);
+
+		ScalarTime = MeasureTime(IterationsCount, [&]
+		{
+			for (auto i{0}; i < ValuesCount; i++)
+			{
+				ScalarValues[i] = UAlsRotation::DamperExactAngle(ScalarValues[i], Targets[i], DeltaTime, HalfLife);
+			}
+		});
+
+		BatchTime = MeasureTime(IterationsCount, [&]
+		{
+			UAlsRotation::DamperExactAngleBatch(BatchValues, Targets, DeltaTime, HalfLife);
+		});
+
+		LogResult(TEXT("DamperExactAngle"), TotalValuesCount, ScalarTime, BatchTime, MaxError);
+
+		// Accuracy of the damper alpha (damping from 0 to 1) compared with the double precision exp() over
+		// a wide range of DeltaTime / HalfLife ratios, for the scalar version and both batched modes.
+
+		static constexpr auto AccuracySamplesCount{4096};
+
+		TArray<float> Zeros;
+		TArray<float> Ones;
+		TArray<float> AccuracyHalfLives;
+		TArray<float> ReferenceAlphas;
+
+		Zeros.SetNumZeroed(AccuracySamplesCount);
+		Ones.Init(1.0f, AccuracySamplesCount);
+		AccuracyHalfLives.SetNumUninitialized(AccuracySamplesCount);
+		ReferenceAlphas.SetNumUninitialized(AccuracySamplesCount);
+
+		ScalarValues.SetNumUninitialized(AccuracySamplesCount);
+
+		for (auto i{0}; i < AccuracySamplesCount; i++)
+		{
+			// DeltaTime / HalfLife ratios from 0.01 to 100.
+			AccuracyHalfLives[i] = DeltaTime / FMath::Pow(10.0f, -2.0f + 4.0f * i / (AccuracySamplesCount - 1));
+
+			ReferenceAlphas[i] = static_cast<float>(1.0 - FMath::Exp(-UE_LN2 * static_cast<double>(DeltaTime) / AccuracyHalfLives[i]));
+			ScalarValues[i] = UAlsMath::DamperExactAlpha(DeltaTime, AccuracyHalfLives[i]);
+		}
+
+		UE_LOGF(LogAls, Log, "Math benchmark: DamperExactAlpha max error: %g.", CalculateMaxError(ScalarValues, ReferenceAlphas));
+
+		for (const auto bFastApproximation : {false, true})
+		{
+			BatchValues = Zeros;
+			UAlsMath::DamperExactBatch(BatchValues, Ones, AccuracyHalfLives, DeltaTime, bFastApproximation);
+
+			UE_LOGF(LogAls, Log, "Math benchmark: DamperExactBatch (%ls) alpha max error: %g.",
+			        bFastApproximation ? TEXT("Fast") : TEXT("Exact"), CalculateMaxError(BatchValues, ReferenceAlphas));
+		}
+	}
+
+	static FAutoConsoleCommand Command{
+		TEXT("Als.Benchmark.Math"),
+		TEXT("Compares throughput and accuracy of the batched ALS damper and spring functions with their scalar versions. ")
+		TEXT("Usage: Als.Benchmark.Math [ValuesCount] [IterationsCount]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&Run)
+	};
+}
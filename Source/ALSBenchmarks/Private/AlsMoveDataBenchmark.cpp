@@ -0,0 +1,207 @@
+#include "AlsCharacterMovementComponent.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#include "UObject/CoreNet.h"
+#include "UObject/Package.h"
+#include "Utility/AlsGameplayTags.h"
+#include "Utility/AlsLog.h"
+
+// Compares the size of the ALS move data in the ServerMove RPCs with the bit-packed tag encoding and with the previous
+// encoding, in which each tag was serialized with NetSerializeOptionalValue(). The moves are generated from a simulated
+// player who changes their rotation mode, stance and gait from time to time, and are also decoded back to verify that
+// the tags survive the round trip. Usage: Als.Benchmark.MoveData [ServerMovesCount]
+
+namespace AlsMoveDataBenchmark
+{
+	static constexpr auto MaxBitsCount{4096};
+
+	// Probabilities per server move.
+
+	static constexpr auto TagChangeProbability{0.02f};
+
+	static constexpr auto UnknownTagProbability{0.002f};
+
+	static constexpr auto PendingMoveProbability{0.3f};
+
+	static constexpr auto OldMoveProbability{0.05f};
+
+	struct FMoveTags
+	{
+		FGameplayTag RotationMode{AlsRotationModeTags::ViewDirection};
+
+		FGameplayTag Stance{AlsStanceTags::Standing};
+
+		FGameplayTag MaxAllowedGait{AlsGaitTags::Running};
+	};
+
+	void ChangeRandomTag(FRandomStream& Random, FMoveTags& Tags)
+	{
+		// Tags from other categories stand in for project-specific tags that are missing from the known tags tables.
+
+		if (Random.FRand() < UnknownTagProbability / TagChangeProbability)
+		{
+			Tags.MaxAllowedGait = AlsOverlayModeTags::Default;
+			return;
+		}
+
+		switch (Random.RandHelper(3))
+		{
+			case 0:
+				Tags.RotationMode = Random.RandHelper(2) == 0 ? AlsRotationModeTags::Aiming : AlsRotationModeTags::ViewDirection;
+				break;
+
+			case 1:
+				Tags.Stance = Random.RandHelper(2) == 0 ? AlsStanceTags::Crouching : AlsStanceTags::Standing;
+				break;
+
+			default:
+				Tags.MaxAllowedGait = Random.RandHelper(2) == 0 ? AlsGaitTags::Sprinting : AlsGaitTags::Running;
+				break;
+		}
+	}
+
+	void FillMoveData(FRandomStream& Random, const FMoveTags& Tags, const float TimeStamp, FAlsCharacterNetworkMoveData& MoveData)
+	{
+		MoveData.TimeStamp = TimeStamp;
+		MoveData.Acceleration = Random.VRand() * Random.FRandRange(0.0f, 2000.0f);
+		MoveData.Location = FVector{Random.FRandRange(-10000.0f, 10000.0f), Random.FRandRange(-10000.0f, 10000.0f), 100.0f};
+		MoveData.ControlRotation = FRotator{Random.FRandRange(-89.0f, 89.0f), Random.FRandRange(-180.0f, 180.0f), 0.0f};
+		MoveData.RotationMode = Tags.RotationMode;
+		MoveData.Stance = Tags.Stance;
+		MoveData.MaxAllowedGait = Tags.MaxAllowedGait;
+	}
+
+	// The relative view rotation is serialized in the base and previous encodings as well, so that only the tags are compared.
+
+	int64 SerializeBase(UCharacterMovementComponent& Movement, FAlsCharacterNetworkMoveData& MoveData, const ENetworkMoveType MoveType)
+	{
+		FNetBitWriter Writer{nullptr, MaxBitsCount};
+		MoveData.FCharacterNetworkMoveData::Serialize(Movement, Writer, nullptr, MoveType);
+		MoveData.NetSerializeRelativeViewRotation(Writer, nullptr);
+
+		return Writer.GetNumBits();
+	}
+
+	int64 SerializePrevious(UCharacterMovementComponent& Movement, FAlsCharacterNetworkMoveData& MoveData, const ENetworkMoveType MoveType)
+	{
+		FNetBitWriter Writer{nullptr, MaxBitsCount};
+		MoveData.FCharacterNetworkMoveData::Serialize(Movement, Writer, nullptr, MoveType);
+
+		NetSerializeOptionalValue(true, Writer, MoveData.RotationMode, AlsRotationModeTags::ViewDirection.GetTag(), nullptr);
+		NetSerializeOptionalValue(true, Writer, MoveData.Stance, AlsStanceTags::Standing.GetTag(), nullptr);
+		NetSerializeOptionalValue(true, Writer, MoveData.MaxAllowedGait, AlsGaitTags::Running.GetTag(), nullptr);
+
+		MoveData.NetSerializeRelativeViewRotation(Writer, nullptr);
+
+		return Writer.GetNumBits();
+	}
+
+	int64 SerializeCurrent(UCharacterMovementComponent& Movement, FAlsCharacterNetworkMoveData& MoveData,
+	                       const ENetworkMoveType MoveType, bool& bRoundTripValid)
+	{
+		FNetBitWriter Writer{nullptr, MaxBitsCount};
+		MoveData.Serialize(Movement, Writer, nullptr, MoveType);
+
+		FNetBitReader Reader{nullptr, Writer.GetData(), Writer.GetNumBits()};
+
+		FAlsCharacterNetworkMoveData DecodedMoveData;
+		DecodedMoveData.Serialize(Movement, Reader, nullptr, MoveType);
+
+		bRoundTripValid = !Reader.IsError() && DecodedMoveData.RotationMode == MoveData.RotationMode &&
+		                  DecodedMoveData.Stance == MoveData.Stance && DecodedMoveData.MaxAllowedGait == MoveData.MaxAllowedGait;
+
+		return Writer.GetNumBits();
+	}
+
+	void Run(const TArray<FString>& Arguments)
+	{
+		const auto ServerMovesCount{Arguments.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Arguments[0])) : 100000};
+
+		auto* Movement{NewObject<UAlsCharacterMovementComponent>(GetTransientPackage())};
+
+		// Pending and old moves are encoded relative to the new move stored in the movement component's move data container.
+
+		auto& NewMoveData{
+			*static_cast<FAlsCharacterNetworkMoveData*>(Movement->GetNetworkMoveDataContainer().GetNewMoveData()) // NOLINT(cppcoreguidelines-pro-type-static-cast-downcast)
+		};
+
+		FAlsCharacterNetworkMoveData PendingMoveData;
+		FAlsCharacterNetworkMoveData OldMoveData;
+
+		FRandomStream Random{0};
+
+		FMoveTags Tags;
+		FMoveTags PreviousTags;
+
+		auto MovesCount{0};
+		auto RoundTripErrorsCount{0};
+
+		int64 BaseBitsCount{0};
+		int64 PreviousBitsCount{0};
+		int64 CurrentBitsCount{0};
+
+		const auto SerializeMove{
+			[&](FAlsCharacterNetworkMoveData& MoveData, const ENetworkMoveType MoveType)
+			{
+				auto bRoundTripValid{false};
+
+				BaseBitsCount += SerializeBase(*Movement, MoveData, MoveType);
+				PreviousBitsCount += SerializePrevious(*Movement, MoveData, MoveType);
+				CurrentBitsCount += SerializeCurrent(*Movement, MoveData, MoveType, bRoundTripValid);
+
+				MovesCount += 1;
+				RoundTripErrorsCount += bRoundTripValid ? 0 : 1;
+			}
+		};
+
+		for (auto i{0}; i < ServerMovesCount; i++)
+		{
+			PreviousTags = Tags;
+
+			if (Random.FRand() < TagChangeProbability)
+			{
+				ChangeRandomTag(Random, Tags);
+			}
+
+			const auto TimeStamp{i / 60.0f};
+
+			// The new move is serialized first, just like in FCharacterNetworkMoveDataContainer::Serialize().
+
+			FillMoveData(Random, Tags, TimeStamp, NewMoveData);
+			SerializeMove(NewMoveData, ENetworkMoveType::NewMove);
+
+			if (Random.FRand() < PendingMoveProbability)
+			{
+				FillMoveData(Random, PreviousTags, TimeStamp, PendingMoveData);
+				SerializeMove(PendingMoveData, ENetworkMoveType::PendingMove);
+			}
+
+			if (Random.FRand() < OldMoveProbability)
+			{
+				FillMoveData(Random, PreviousTags, TimeStamp, OldMoveData);
+				SerializeMove(OldMoveData, ENetworkMoveType::OldMove);
+			}
+		}
+
+		Movement->MarkAsGarbage();
+
+		const auto PreviousTagBitsCount{static_cast<double>(PreviousBitsCount - BaseBitsCount)};
+		const auto CurrentTagBitsCount{static_cast<double>(CurrentBitsCount - BaseBitsCount)};
+
+		UE_LOGF(LogAls, Log, "Move data benchmark: %d server moves, %d moves, %d round trip errors.",
+		        ServerMovesCount, MovesCount, RoundTripErrorsCount);
+
+		UE_LOGF(LogAls, Log, "Move data benchmark: previous: %.2f bits per server move (%.2f for ALS tags), "
+		        "current: %.2f bits per server move (%.2f for ALS tags), %.1f%% less ALS tag bandwidth.",
+		        static_cast<double>(PreviousBitsCount) / ServerMovesCount, PreviousTagBitsCount / ServerMovesCount,
+		        static_cast<double>(CurrentBitsCount) / ServerMovesCount, CurrentTagBitsCount / ServerMovesCount,
+		        PreviousTagBitsCount > 0.0 ? (1.0 - CurrentTagBitsCount / PreviousTagBitsCount) * 100.0 : 0.0);
+	}
+
+	static FAutoConsoleCommand Command{
+		TEXT("Als.Benchmark.MoveData"),
+		TEXT("Compares the size of the ALS move data in the ServerMove RPCs with the bit-packed and the previous tag encoding. ")
+		TEXT("Usage: Als.Benchmark.MoveData [ServerMovesCount]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&Run)
+	};
+}
@@ -0,0 +1,142 @@
+#include "AlsCameraComponent.h"
+#include "Async/ParallelFor.h"
+#include "Engine/GameInstance.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Utility/AlsLog.h"
+
+// Measures the camera tick of several local players, as in a split-screen game. Missing local players are created first,
+// so the game mode must spawn pawns with an ALS camera component for them. Each camera is ticked with a fixed time step,
+// and the average tick time of each camera is reported. After the ticks, the collision resolution of all cameras is run
+// once on the game thread one camera after another, and once in parallel on task graph workers, one task per camera,
+// and the average time of both batches is reported. Usage: Als.Benchmark.SplitScreen [LocalPlayersCount] [FramesCount]
+
+namespace AlsSplitScreenBenchmark
+{
+	static constexpr auto DeltaTime{1.0f / 60.0f};
+
+	void Run(const TArray<FString>& Arguments, UWorld* World)
+	{
+		const auto LocalPlayersCount{Arguments.Num() > 0 ? FMath::Clamp(FCString::Atoi(*Arguments[0]), 1, 8) : 4};
+		const auto FramesCount{Arguments.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Arguments[1])) : 1000};
+
+		auto* GameInstance{IsValid(World) ? World->GetGameInstance() : nullptr};
+		if (!IsValid(GameInstance))
+		{
+			UE_LOGF(LogAls, Warning, "Split screen benchmark: the benchmark can only be run in a game world.");
+			return;
+		}
+
+		while (GameInstance->GetNumLocalPlayers() < LocalPlayersCount)
+		{
+			FString Error;
+			if (GameInstance->CreateLocalPlayer(GameInstance->GetNumLocalPlayers(), Error, true) == nullptr)
+			{
+				UE_LOGF(LogAls, Warning, "Split screen benchmark: failed to create a local player: %ls.", *Error);
+				break;
+			}
+		}
+
+		TArray<UAlsCameraComponent*, TInlineAllocator<8>> Cameras;
+
+		for (const auto* LocalPlayer : GameInstance->GetLocalPlayers())
+		{
+			const auto* Player{LocalPlayer->GetPlayerController(World)};
+			const auto* Pawn{IsValid(Player) ? Player->GetPawn() : nullptr};
+			auto* Camera{IsValid(Pawn) ? Pawn->FindComponentByClass<UAlsCameraComponent>() : nullptr};
+
+			if (IsValid(Camera) && Cameras.Num() < LocalPlayersCount)
+			{
+				Cameras.Add(Camera);
+			}
+		}
+
+		if (Cameras.Num() < LocalPlayersCount)
+		{
+			UE_LOGF(LogAls, Warning, "Split screen benchmark: only %d of %d local players have an ALS camera.",
+			        Cameras.Num(), LocalPlayersCount);
+
+			if (Cameras.IsEmpty())
+			{
+				return;
+			}
+		}
+
+		TArray<double, TInlineAllocator<8>> CameraTimes;
+		CameraTimes.SetNumZeroed(Cameras.Num());
+
+		TArray<FVector, TInlineAllocator<8>> CollisionLocations;
+		CollisionLocations.SetNumUninitialized(Cameras.Num());
+
+		auto SequentialCollisionTime{0.0};
+		auto ParallelCollisionTime{0.0};
+
+		for (auto i{0}; i < FramesCount; i++)
+		{
+			for (auto j{0}; j < Cameras.Num(); j++)
+			{
+				auto* Camera{Cameras[j]};
+				const auto StartTime{FPlatformTime::Seconds()};
+
+				Camera->TickComponent(DeltaTime, LEVELTICK_All, &Camera->PrimaryComponentTick);
+
+				CameraTimes[j] += FPlatformTime::Seconds() - StartTime;
+			}
+
+			// Socket locations are read on the game thread, so that the workers only query the scene.
+
+			for (auto j{0}; j < Cameras.Num(); j++)
+			{
+				CollisionLocations[j] = Cameras[j]->GetThirdPersonTraceStartLocation();
+			}
+
+			auto StartTime{FPlatformTime::Seconds()};
+
+			for (auto j{0}; j < Cameras.Num(); j++)
+			{
+				auto Location{CollisionLocations[j]};
+				Cameras[j]->TryAdjustLocationBlockedByGeometry(Location, false);
+			}
+
+			SequentialCollisionTime += FPlatformTime::Seconds() - StartTime;
+			StartTime = FPlatformTime::Seconds();
+
+			ParallelFor(TEXT("AlsSplitScreenBenchmark::Run"), Cameras.Num(), 1, [&Cameras, &CollisionLocations](const int32 Index)
+			{
+				auto Location{CollisionLocations[Index]};
+				Cameras[Index]->TryAdjustLocationBlockedByGeometry(Location, false);
+			});
+
+			ParallelCollisionTime += FPlatformTime::Seconds() - StartTime;
+		}
+
+		auto TotalTime{0.0};
+
+		for (auto i{0}; i < Cameras.Num(); i++)
+		{
+			UE_LOGF(LogAls, Log, "Split screen benchmark: camera %d (%ls): average tick time %.2f us.",
+			        i, *GetNameSafe(Cameras[i]->GetOwner()), CameraTimes[i] / FramesCount * 1e6);
+
+			TotalTime += CameraTimes[i];
+		}
+
+		UE_LOGF(LogAls, Log, "Split screen benchmark: %d cameras, %d frames, average time of all camera ticks per frame %.2f us.",
+		        Cameras.Num(), FramesCount, TotalTime / FramesCount * 1e6);
+
+		UE_LOGF(LogAls, Log, "Split screen benchmark: average collision resolution time of all cameras per frame:"
+		        " sequential %.2f us, parallel %.2f us.",
+		        SequentialCollisionTime / FramesCount * 1e6, ParallelCollisionTime / FramesCount * 1e6);
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs Command{
+		TEXT("Als.Benchmark.SplitScreen"),
+		TEXT("Creates the missing local players and measures the ALS camera tick of each of them, ")
+		TEXT("as well as the collision resolution of all cameras on the game thread and in parallel. ")
+		TEXT("Usage: Als.Benchmark.SplitScreen [LocalPlayersCount] [FramesCount]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&Run)
+	};
+}
@@ -0,0 +1,121 @@
+#include "AlsStateRecorderSubsystem.h"
+#include "Engine/EngineTypes.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Utility/AlsLog.h"
+
+// Writes random recorded character states to memory the same way the state recorder writes them to a file, reads them
+// back and verifies that every field survives the round trip. Also reports the size of a recorded state and the maximum
+// error of the compressed rotations. Usage: Als.Benchmark.StateRecording [StatesCount]
+
+namespace AlsStateRecordingBenchmark
+{
+	FAlsRecordedCharacterState MakeRandomState(FRandomStream& Random)
+	{
+		const auto RandomByte{[&Random] { return static_cast<uint8>(Random.RandHelper(MAX_uint8 + 1)); }};
+		const auto RandomInputAxis{[&Random] { return static_cast<int8>(Random.RandRange(-127, 127)); }};
+
+		FAlsRecordedCharacterState State;
+		State.CharacterIndex = static_cast<uint16>(Random.RandHelper(MAX_uint16 + 1));
+		State.ViewModeIndex = RandomByte();
+		State.DesiredRotationModeIndex = RandomByte();
+		State.DesiredStanceIndex = RandomByte();
+		State.DesiredGaitIndex = RandomByte();
+		State.OverlayModeIndex = RandomByte();
+		State.bDesiredAiming = Random.RandHelper(2) == 0;
+		State.MovementMode = static_cast<uint8>(Random.RandHelper(MOVE_MAX));
+		State.CustomMovementMode = RandomByte();
+		State.InputDirectionX = RandomInputAxis();
+		State.InputDirectionY = RandomInputAxis();
+		State.InputDirectionZ = RandomInputAxis();
+		State.ViewPitch = FRotator::CompressAxisToShort(Random.FRandRange(-89.0f, 89.0f));
+		State.ViewYaw = FRotator::CompressAxisToShort(Random.FRandRange(-180.0f, 180.0f));
+		State.Location = FVector3f{Random.VRand() * Random.FRandRange(0.0f, 100000.0f)};
+		State.Yaw = FRotator::CompressAxisToShort(Random.FRandRange(-180.0f, 180.0f));
+		State.Velocity = FVector3f{Random.VRand() * Random.FRandRange(0.0f, 2000.0f)};
+
+		return State;
+	}
+
+	bool AreStatesEqual(const FAlsRecordedCharacterState& A, const FAlsRecordedCharacterState& B)
+	{
+		return A.CharacterIndex == B.CharacterIndex && A.ViewModeIndex == B.ViewModeIndex &&
+		       A.DesiredRotationModeIndex == B.DesiredRotationModeIndex && A.DesiredStanceIndex == B.DesiredStanceIndex &&
+		       A.DesiredGaitIndex == B.DesiredGaitIndex && A.OverlayModeIndex == B.OverlayModeIndex &&
+		       A.bDesiredAiming == B.bDesiredAiming && A.MovementMode == B.MovementMode &&
+		       A.CustomMovementMode == B.CustomMovementMode && A.InputDirectionX == B.InputDirectionX &&
+		       A.InputDirectionY == B.InputDirectionY && A.InputDirectionZ == B.InputDirectionZ &&
+		       A.ViewPitch == B.ViewPitch && A.ViewYaw == B.ViewYaw && A.Location == B.Location &&
+		       A.Yaw == B.Yaw && A.Velocity == B.Velocity;
+	}
+
+	void Run(const TArray<FString>& Arguments)
+	{
+		const auto StatesCount{Arguments.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Arguments[0])) : 100000};
+
+		FRandomStream Random{0};
+
+		TArray<FAlsRecordedCharacterState> States;
+		States.Reserve(StatesCount);
+
+		for (auto i{0}; i < StatesCount; i++)
+		{
+			States.Add(MakeRandomState(Random));
+		}
+
+		TArray<uint8> Data;
+		FMemoryWriter Writer{Data};
+
+		for (auto& State : States)
+		{
+			Writer << State;
+		}
+
+		FMemoryReader Reader{Data};
+
+		auto RoundTripErrorsCount{0};
+
+		for (const auto& State : States)
+		{
+			FAlsRecordedCharacterState DecodedState;
+			Reader << DecodedState;
+
+			RoundTripErrorsCount += !Reader.IsError() && AreStatesEqual(State, DecodedState) ? 0 : 1;
+		}
+
+		if (!Reader.AtEnd())
+		{
+			UE_LOGF(LogAls, Error, "State recording benchmark: %lld bytes left unread.", Reader.TotalSize() - Reader.Tell());
+		}
+
+		// The rotations are compressed before they are written, so their precision is limited by the compression.
+
+		auto MaxRotationError{0.0f};
+
+		for (auto i{0}; i < StatesCount; i++)
+		{
+			const auto Yaw{Random.FRandRange(-180.0f, 180.0f)};
+			const auto DecompressedYaw{FRotator::DecompressAxisFromShort(FRotator::CompressAxisToShort(Yaw))};
+
+			MaxRotationError = FMath::Max(MaxRotationError, FMath::Abs(FRotator::NormalizeAxis(DecompressedYaw - Yaw)));
+		}
+
+		UE_LOGF(LogAls, Log, "State recording benchmark: %d states, %d round trip errors, %.2f bytes per state, "
+		        "max rotation error %g degrees.", StatesCount, RoundTripErrorsCount,
+		        static_cast<double>(Data.Num()) / StatesCount, MaxRotationError);
+
+		if (RoundTripErrorsCount > 0)
+		{
+			UE_LOGF(LogAls, Error, "State recording benchmark: %d states didn't survive the round trip.", RoundTripErrorsCount);
+		}
+	}
+
+	static FAutoConsoleCommand Command{
+		TEXT("Als.Benchmark.StateRecording"),
+		TEXT("Verifies that recorded ALS character states survive the write and read round trip and reports their size. ")
+		TEXT("Usage: Als.Benchmark.StateRecording [StatesCount]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&Run)
+	};
+}
@@ -0,0 +1,215 @@
+#pragma once
+
+#include "Engine/EngineTypes.h"
+#include "HAL/CriticalSection.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AlsCrowdBenchmarkSubsystem.generated.h"
+
+class AAlsCharacter;
+class AActor;
+class UAlsCameraComponent;
+
+UENUM()
+enum class EAlsCrowdBenchmarkPhase : uint8
+{
+	Idle,
+	WalkingCircles,
+	Sprinting,
+	JumpingAndMantling,
+	JumpingAndMantlingWithLedgeIndex,
+	Ragdolling
+};
+
+UENUM()
+enum class EAlsCrowdBenchmarkCategory : uint8
+{
+	Frame,
+	CharacterTick,
+	MovementComponentTick,
+	AnimationGameThreadUpdate,
+	AnimationWorkerUpdate,
+	AnimationEvaluation,
+	AnimationGameThreadTotal,
+	CameraTick,
+	Count UMETA(Hidden)
+};
+
+struct ALSBENCHMARKS_API FAlsCrowdBenchmarkTiming
+{
+	double TotalTime{0.0};
+
+	double MaxTime{0.0};
+
+	// Category times are received from the stats thread, so their samples count may differ slightly from the frames count.
+	int32 SamplesCount{0};
+
+	void AddSample(double Time);
+
+	double GetAverageTime() const;
+};
+
+struct ALSBENCHMARKS_API FAlsCrowdBenchmarkPhaseResult
+{
+	EAlsCrowdBenchmarkPhase Phase{EAlsCrowdBenchmarkPhase::Idle};
+
+	int32 FramesCount{0};
+
+	// Times in milliseconds, indexed by EAlsCrowdBenchmarkCategory.
+	TStaticArray<FAlsCrowdBenchmarkTiming, static_cast<int32>(EAlsCrowdBenchmarkCategory::Count)> Timings;
+
+	int32 StatsFramesCount{0};
+
+	int64 MantlingSceneQueriesCount{0};
+
+	double GetMantlingSceneQueriesPerFrame() const;
+};
+
+struct ALSBENCHMARKS_API FAlsCrowdBenchmarkStatsFrame
+{
+	// Times in milliseconds, indexed by EAlsCrowdBenchmarkCategory.
+	TStaticArray<double, static_cast<int32>(EAlsCrowdBenchmarkCategory::Count)> Times{InPlace, 0.0};
+
+	int32 MantlingSceneQueriesCount{0};
+};
+
+struct ALSBENCHMARKS_API FAlsCrowdBenchmarkRunResult
+{
+	int32 CharactersCount{0};
+
+	/// Frame time budget in milliseconds, or a negative value if there is no budget for this run.
+	float FrameTimeBudget{-1.0f};
+
+	TArray<FAlsCrowdBenchmarkPhaseResult> Phases;
+
+	bool IsWithinBudget() const;
+};
+
+struct ALSBENCHMARKS_API FAlsCrowdBenchmarkCharacter
+{
+	TWeakObjectPtr<AAlsCharacter> Character;
+
+	TWeakObjectPtr<UAlsCameraComponent> Camera;
+
+	TWeakObjectPtr<AActor> Obstacle;
+
+	FVector SpawnLocation{ForceInit};
+};
+
+/// Headless crowd benchmark. Spawns the requested numbers of ALS characters on a generated floor, drives them through
+/// scripted movement phases (idle, walking in circles, sprinting, jumping and mantling, ragdolling) with a fixed time
+/// step, and measures the frame time along with the time spent in the character tick, movement component tick, animation
+/// game thread and worker thread update, animation evaluation, total animation game thread time, and camera tick.
+/// The characters are ticked by the world as usual, and the time of each category is taken from its cycle stat, summed
+/// over all threads, so the category times are only available in builds with stats enabled.
+/// The jumping and mantling phase is run once with the mantling traces and once with the ledge index, and the number of
+/// mantling scene queries per frame is reported for both.
+/// The results are written to CSV and JSON reports, and the process exits with a non-zero code if any frame time budget
+/// is exceeded or the reports can't be written. Only created when the -AlsBenchmark command line switch is present:
+///
+/// UnrealEditor-Cmd <Project> <Map> -game -nullrhi -nosound -unattended -AlsBenchmark [-AlsBenchmarkCounts=50,200,500]
+/// [-AlsBenchmarkBudgets=50:8,200:16,500:33] [-AlsBenchmarkFrames=300] [-AlsBenchmarkCharacterClass=<Class>]
+/// [-AlsBenchmarkOutput=<Directory>]
+UCLASS()
+class ALSBENCHMARKS_API UAlsCrowdBenchmarkSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static constexpr auto FixedDeltaTime{1.0 / 30.0};
+
+	static constexpr auto WarmUpFramesCount{30};
+
+	static constexpr auto CharactersSpacing{600.0f};
+
+	static constexpr auto SpawnHeight{10000.0f};
+
+	static constexpr auto JumpInterval{45};
+
+	static constexpr auto MovementDirectionChangeInterval{60};
+
+protected:
+	UPROPERTY(Transient)
+	TObjectPtr<UClass> CharacterClass;
+
+	TArray<int32> CharactersCounts;
+
+	TMap<int32, float> FrameTimeBudgets;
+
+	int32 MeasuredFramesCount{300};
+
+	FString OutputDirectory;
+
+	TArray<FAlsCrowdBenchmarkCharacter> Characters;
+
+	TWeakObjectPtr<AActor> Floor;
+
+	int32 RunIndex{INDEX_NONE};
+
+	EAlsCrowdBenchmarkPhase Phase{EAlsCrowdBenchmarkPhase::Idle};
+
+	int32 PhaseFrame{0};
+
+	uint64 PreviousFrameCycles{0};
+
+	// Stats frames are received on the stats thread and added to the results on the game thread. They
+	// lag a few frames behind the game thread, which is covered by the warm-up frames of each phase.
+
+	FCriticalSection StatsFramesLock;
+
+	TArray<FAlsCrowdBenchmarkStatsFrame> PendingStatsFrames;
+
+	FDelegateHandle NewStatsFrameDelegateHandle;
+
+	TArray<FAlsCrowdBenchmarkRunResult> Results;
+
+	uint8 bDefaultUseLedgeIndex : 1 {false};
+
+	uint8 bCapturingStats : 1 {false};
+
+	uint8 bFinished : 1 {false};
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	virtual void OnWorldBeginPlay(UWorld& World) override;
+
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(EWorldType::Type WorldType) const override;
+
+private:
+	void ParseCommandLine();
+
+	void StartStatsCapture();
+
+	void StopStatsCapture();
+
+	void OnNewStatsFrame(int64 Frame);
+
+	void AddStatsFrames();
+
+	void StartRun(int32 NewRunIndex);
+
+	void StartPhase(EAlsCrowdBenchmarkPhase NewPhase);
+
+	void FinishPhase();
+
+	void SpawnCharacters(int32 Count);
+
+	void DestroyCharacters();
+
+	AActor* SpawnBox(const FVector& Location, const FVector& Scale, EComponentMobility::Type Mobility) const;
+
+	void SetUseLedgeIndex(bool bUseLedgeIndex) const;
+
+	void ApplyPhaseInput(int32 CharacterIndex, AAlsCharacter* Character) const;
+
+	void Finish();
+
+	bool WriteReports() const;
+};
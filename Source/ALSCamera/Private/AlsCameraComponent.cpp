@@ -3,15 +3,16 @@
 #include "AlsCameraSettings.h"
 #include "DrawDebugHelpers.h"
 #include "Animation/AnimInstance.h"
-#include "Engine/OverlapResult.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/WorldSettings.h"
 #include "Misc/DataValidation.h"
 #include "Misc/UObjectToken.h"
+#include "Utility/AlsAnimationCurveCache.h"
 #include "Utility/AlsCameraConstants.h"
 #include "Utility/AlsDebugUtility.h"
 #include "Utility/AlsMacros.h"
 #include "Utility/AlsRotation.h"
+#include "Utility/AlsStats.h"
 #include "Utility/AlsUtility.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsCameraComponent)
@@ -181,6 +182,7 @@ void UAlsCameraComponent::TickCamera(const float DeltaTime, bool bAllowLag)
 {
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsCameraComponent::TickCamera"), STAT_UAlsCameraComponent_TickCamera, STATGROUP_Als)
 	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+	CSV_SCOPED_TIMING_STAT(Als, CameraTick);
 
 	if (!IsValid(GetAnimInstance()) || !IsValid(Settings) || !IsValid(Character))
 	{
@@ -240,9 +242,9 @@ void UAlsCameraComponent::TickCamera(const float DeltaTime, bool bAllowLag)
 
 	PivotTargetLocation = GetThirdPersonPivotLocation();
 
-	const auto FirstPersonOverride{
-		UAlsMath::Clamp01(GetAnimInstance()->GetCurveValue(UAlsCameraConstants::FirstPersonOverrideCurveName()))
-	};
+	const auto Curves{ReadCurves()};
+
+	const auto FirstPersonOverride{UAlsMath::Clamp01(Curves.FirstPersonOverride)};
 
 	if (FAnimWeight::IsFullWeight(FirstPersonOverride))
 	{
@@ -269,13 +271,13 @@ void UAlsCameraComponent::TickCamera(const float DeltaTime, bool bAllowLag)
 	{
 		CameraRotation = (MovementBaseRotation * CameraRotationMovementBaseSpace).Rotator();
 
-		CameraRotation = CalculateCameraRotation(CameraTargetRotation, DeltaTime, bAllowLag);
+		CameraRotation = CalculateCameraRotation(Curves, CameraTargetRotation, DeltaTime, bAllowLag);
 
 		CameraRotationMovementBaseSpace = MovementBaseRotation.Inverse() * CameraRotation.Quaternion();
 	}
 	else
 	{
-		CameraRotation = CalculateCameraRotation(CameraTargetRotation, DeltaTime, bAllowLag);
+		CameraRotation = CalculateCameraRotation(Curves, CameraTargetRotation, DeltaTime, bAllowLag);
 	}
 
 	const FQuat CameraYawRotation{FVector::UpVector, FMath::DegreesToRadians(CameraRotation.Yaw)};
@@ -293,13 +295,13 @@ void UAlsCameraComponent::TickCamera(const float DeltaTime, bool bAllowLag)
 	{
 		PivotLagLocation = MovementBaseLocation + MovementBaseRotation.RotateVector(PivotLagLocationMovementBaseSpace);
 
-		PivotLagLocation = CalculatePivotLagLocation(CameraYawRotation, DeltaTime, bAllowLag);
+		PivotLagLocation = CalculatePivotLagLocation(Curves, CameraYawRotation, DeltaTime, bAllowLag);
 
 		PivotLagLocationMovementBaseSpace = MovementBaseRotation.UnrotateVector(PivotLagLocation - MovementBaseLocation);
 	}
 	else
 	{
-		PivotLagLocation = CalculatePivotLagLocation(CameraYawRotation, DeltaTime, bAllowLag);
+		PivotLagLocation = CalculatePivotLagLocation(Curves, CameraYawRotation, DeltaTime, bAllowLag);
 	}
 
 #if ENABLE_DRAW_DEBUG
@@ -315,7 +317,7 @@ void UAlsCameraComponent::TickCamera(const float DeltaTime, bool bAllowLag)
 
 	// Calculate pivot location.
 
-	const auto PivotOffset{CalculatePivotOffset()};
+	const auto PivotOffset{CalculatePivotOffset(Curves)};
 
 	PivotLocation = PivotLagLocation + PivotOffset;
 
@@ -332,11 +334,13 @@ void UAlsCameraComponent::TickCamera(const float DeltaTime, bool bAllowLag)
 
 	// Calculate target camera location.
 
-	const auto CameraTargetLocation{PivotLocation + CalculateCameraOffset()};
+	const auto CameraTargetLocation{PivotLocation + CalculateCameraOffset(Curves)};
 
 	// Trace for an object between the camera and character to apply a corrective offset.
 
-	const auto CameraFinalLocation{CalculateCameraTrace(CameraTargetLocation, PivotOffset, DeltaTime, bAllowLag, TraceDistanceRatio)};
+	const auto CameraFinalLocation{
+		CalculateCameraTrace(Curves, CameraTargetLocation, PivotOffset, DeltaTime, bAllowLag, TraceDistanceRatio)
+	};
 
 	if (!FAnimWeight::IsRelevant(FirstPersonOverride))
 	{
@@ -354,10 +358,50 @@ void UAlsCameraComponent::TickCamera(const float DeltaTime, bool bAllowLag)
 		CameraFieldOfView = FieldOfViewOverride;
 	}
 
-	CameraFieldOfView = FMath::Clamp(CameraFieldOfView + CalculateFovOffset(), 5.0f, 175.0f);
+	CameraFieldOfView = FMath::Clamp(CameraFieldOfView + Curves.FovOffset, 5.0f, 175.0f);
 }
 
-FRotator UAlsCameraComponent::CalculateCameraRotation(const FRotator& CameraTargetRotation,
+FAlsCameraCurves UAlsCameraComponent::ReadCurves()
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsCameraComponent::ReadCurves"), STAT_UAlsCameraComponent_ReadCurves, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
+	const auto& AnimationCurves{GetAnimInstance()->GetAnimationCurveList(EAnimCurveType::AttributeCurve)};
+
+	auto CurveIndex{0};
+
+	const auto GetCurveValue{
+		[this, &AnimationCurves, &CurveIndex](const FName CurveName)
+		{
+			return FAlsAnimationCurveCache::GetCurveValue(AnimationCurves, CurveName, CurveElementIds[CurveIndex++]);
+		}
+	};
+
+	FAlsCameraCurves Curves;
+
+	Curves.PivotOffset.X = GetCurveValue(UAlsCameraConstants::PivotOffsetXCurveName());
+	Curves.PivotOffset.Y = GetCurveValue(UAlsCameraConstants::PivotOffsetYCurveName());
+	Curves.PivotOffset.Z = GetCurveValue(UAlsCameraConstants::PivotOffsetZCurveName());
+
+	Curves.CameraOffset.X = GetCurveValue(UAlsCameraConstants::CameraOffsetXCurveName());
+	Curves.CameraOffset.Y = GetCurveValue(UAlsCameraConstants::CameraOffsetYCurveName());
+	Curves.CameraOffset.Z = GetCurveValue(UAlsCameraConstants::CameraOffsetZCurveName());
+
+	Curves.LocationLag.X = GetCurveValue(UAlsCameraConstants::LocationLagXCurveName());
+	Curves.LocationLag.Y = GetCurveValue(UAlsCameraConstants::LocationLagYCurveName());
+	Curves.LocationLag.Z = GetCurveValue(UAlsCameraConstants::LocationLagZCurveName());
+
+	Curves.RotationLag = GetCurveValue(UAlsCameraConstants::RotationLagCurveName());
+	Curves.FovOffset = GetCurveValue(UAlsCameraConstants::FovOffsetCurveName());
+	Curves.FirstPersonOverride = GetCurveValue(UAlsCameraConstants::FirstPersonOverrideCurveName());
+	Curves.TraceOverride = GetCurveValue(UAlsCameraConstants::TraceOverrideCurveName());
+
+	check(CurveIndex == CurveElementIds.Num())
+
+	return Curves;
+}
+
+FRotator UAlsCameraComponent::CalculateCameraRotation(const FAlsCameraCurves& Curves, const FRotator& CameraTargetRotation,
                                                       const float DeltaTime, const bool bAllowLag) const
 {
 	if (!bAllowLag)
@@ -365,12 +409,11 @@ FRotator UAlsCameraComponent::CalculateCameraRotation(const FRotator& CameraTarg
 		return CameraTargetRotation;
 	}
 
-	const auto RotationLag{GetAnimInstance()->GetCurveValue(UAlsCameraConstants::RotationLagCurveName())};
-
-	return UAlsRotation::DamperExactRotation(CameraRotation, CameraTargetRotation, DeltaTime, RotationLag);
+	return UAlsRotation::DamperExactRotation(CameraRotation, CameraTargetRotation, DeltaTime, Curves.RotationLag);
 }
 
-FVector UAlsCameraComponent::CalculatePivotLagLocation(const FQuat& CameraYawRotation, const float DeltaTime, const bool bAllowLag) const
+FVector UAlsCameraComponent::CalculatePivotLagLocation(const FAlsCameraCurves& Curves, const FQuat& CameraYawRotation,
+                                                       const float DeltaTime, const bool bAllowLag) const
 {
 	if (!bAllowLag)
 	{
@@ -380,45 +423,32 @@ FVector UAlsCameraComponent::CalculatePivotLagLocation(const FQuat& CameraYawRot
 	const auto PivotLagLocationCameraSpace{CameraYawRotation.UnrotateVector(PivotLagLocation)};
 	const auto PivotTargetLocationCameraSpace{CameraYawRotation.UnrotateVector(PivotTargetLocation)};
 
-	const auto LocationLagX{GetAnimInstance()->GetCurveValue(UAlsCameraConstants::LocationLagXCurveName())};
-	const auto LocationLagY{GetAnimInstance()->GetCurveValue(UAlsCameraConstants::LocationLagYCurveName())};
-	const auto LocationLagZ{GetAnimInstance()->GetCurveValue(UAlsCameraConstants::LocationLagZCurveName())};
-
 	return CameraYawRotation.RotateVector({
-		UAlsMath::DamperExact(PivotLagLocationCameraSpace.X, PivotTargetLocationCameraSpace.X, DeltaTime, LocationLagX),
-		UAlsMath::DamperExact(PivotLagLocationCameraSpace.Y, PivotTargetLocationCameraSpace.Y, DeltaTime, LocationLagY),
-		UAlsMath::DamperExact(PivotLagLocationCameraSpace.Z, PivotTargetLocationCameraSpace.Z, DeltaTime, LocationLagZ)
+		UAlsMath::DamperExact(PivotLagLocationCameraSpace.X, PivotTargetLocationCameraSpace.X, DeltaTime, Curves.LocationLag.X),
+		UAlsMath::DamperExact(PivotLagLocationCameraSpace.Y, PivotTargetLocationCameraSpace.Y, DeltaTime, Curves.LocationLag.Y),
+		UAlsMath::DamperExact(PivotLagLocationCameraSpace.Z, PivotTargetLocationCameraSpace.Z, DeltaTime, Curves.LocationLag.Z)
 	});
 }
 
-FVector UAlsCameraComponent::CalculatePivotOffset() const
+FVector UAlsCameraComponent::CalculatePivotOffset(const FAlsCameraCurves& Curves) const
 {
 	return Character->GetMesh()->GetComponentQuat().RotateVector(
-		FVector{
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::PivotOffsetXCurveName()),
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::PivotOffsetYCurveName()),
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::PivotOffsetZCurveName())
-		} * Character->GetMesh()->GetComponentScale().Z);
+		FVector{Curves.PivotOffset} * Character->GetMesh()->GetComponentScale().Z);
 }
 
-FVector UAlsCameraComponent::CalculateCameraOffset() const
+FVector UAlsCameraComponent::CalculateCameraOffset(const FAlsCameraCurves& Curves) const
 {
-	return CameraRotation.RotateVector(
-		FVector{
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::CameraOffsetXCurveName()),
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::CameraOffsetYCurveName()),
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::CameraOffsetZCurveName())
-		} * Character->GetMesh()->GetComponentScale().Z);
+	return CameraRotation.RotateVector(FVector{Curves.CameraOffset} * Character->GetMesh()->GetComponentScale().Z);
 }
 
-float UAlsCameraComponent::CalculateFovOffset() const
+FVector UAlsCameraComponent::CalculateCameraTrace(const FAlsCameraCurves& Curves, const FVector& CameraTargetLocation,
+                                                  const FVector& PivotOffset, const float DeltaTime, const bool bAllowLag,
+                                                  float& NewTraceDistanceRatio) const
 {
-	return GetAnimInstance()->GetCurveValue(UAlsCameraConstants::FovOffsetCurveName());
-}
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsCameraComponent::CalculateCameraTrace"),
+	                            STAT_UAlsCameraComponent_CalculateCameraTrace, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
 
-FVector UAlsCameraComponent::CalculateCameraTrace(const FVector& CameraTargetLocation, const FVector& PivotOffset,
-                                                  const float DeltaTime, const bool bAllowLag, float& NewTraceDistanceRatio) const
-{
 #if ENABLE_DRAW_DEBUG
 	const auto bDisplayDebugCameraTraces{
 		UAlsDebugUtility::ShouldDisplayDebugForActor(GetOwner(), UAlsCameraConstants::CameraTracesDebugDisplayName())
@@ -435,7 +465,7 @@ FVector UAlsCameraComponent::CalculateCameraTrace(const FVector& CameraTargetLoc
 		FMath::Lerp(
 			GetThirdPersonTraceStartLocation(),
 			PivotTargetLocation + PivotOffset + FVector{Settings->ThirdPerson.TraceOverrideOffset},
-			UAlsMath::Clamp01(GetAnimInstance()->GetCurveValue(UAlsCameraConstants::TraceOverrideCurveName())))
+			UAlsMath::Clamp01(Curves.TraceOverride))
 	};
 
 	const auto TraceEnd{CameraTargetLocation};
@@ -444,6 +474,7 @@ FVector UAlsCameraComponent::CalculateCameraTrace(const FVector& CameraTargetLoc
 	auto TraceResult{TraceEnd};
 
 	FHitResult Hit;
+	ALS_INC_COUNTER(CameraSceneQueries);
 	if (GetWorld()->SweepSingleByChannel(Hit, TraceStart, TraceEnd, FQuat::Identity, Settings->ThirdPerson.TraceChannel,
 	                                     CollisionShape, {MainTraceTag, false, GetOwner()}))
 	{
@@ -455,6 +486,7 @@ FVector UAlsCameraComponent::CalculateCameraTrace(const FVector& CameraTargetLoc
 		{
 			static const FName AdjustedTraceTag{TStringView{FAnsiString::Printf("%s (Adjusted Trace)", __FUNCTION__)}};
 
+			ALS_INC_COUNTER(CameraSceneQueries);
 			GetWorld()->SweepSingleByChannel(Hit, TraceStart, TraceEnd, FQuat::Identity, Settings->ThirdPerson.TraceChannel,
 			                                 CollisionShape, {AdjustedTraceTag, false, GetOwner()});
 			if (Hit.IsValidBlockingHit())
@@ -507,12 +539,15 @@ FVector UAlsCameraComponent::CalculateCameraTrace(const FVector& CameraTargetLoc
 
 bool UAlsCameraComponent::TryAdjustLocationBlockedByGeometry(FVector& Location, const bool bDisplayDebugCameraTraces) const
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsCameraComponent::TryAdjustLocationBlockedByGeometry"),
+	                            STAT_UAlsCameraComponent_TryAdjustLocationBlockedByGeometry, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	// Based on ComponentEncroachesBlockingGeometry_WithAdjustment().
 
 	const auto MeshScale{UE_REAL_TO_FLOAT(Character->GetMesh()->GetComponentScale().Z)};
 	const auto CollisionShape{FCollisionShape::MakeSphere((Settings->ThirdPerson.TraceRadius + 1.0f) * MeshScale)};
 
-	static TArray<FOverlapResult> Overlaps;
 	check(Overlaps.IsEmpty())
 
 	ON_SCOPE_EXIT
@@ -522,6 +557,7 @@ bool UAlsCameraComponent::TryAdjustLocationBlockedByGeometry(FVector& Location,
 
 	static const FName OverlapMultiTraceTag{TStringView{FAnsiString::Printf("%s (Overlap Multi)", __FUNCTION__)}};
 
+	ALS_INC_COUNTER(CameraSceneQueries);
 	if (!GetWorld()->OverlapMultiByChannel(Overlaps, Location, FQuat::Identity, Settings->ThirdPerson.TraceChannel,
 	                                       CollisionShape, {OverlapMultiTraceTag, false, GetOwner()}))
 	{
@@ -581,6 +617,7 @@ bool UAlsCameraComponent::TryAdjustLocationBlockedByGeometry(FVector& Location,
 
 	static const FName FreeSpaceTraceTag{TStringView{FAnsiString::Printf("%s (Free Space Overlap)", __FUNCTION__)}};
 
+	ALS_INC_COUNTER(CameraSceneQueries);
 	return !GetWorld()->OverlapBlockingTestByChannel(Location, FQuat::Identity, Settings->ThirdPerson.TraceChannel,
 	                                                 FCollisionShape::MakeSphere(Settings->ThirdPerson.TraceRadius * MeshScale),
 	                                                 {FreeSpaceTraceTag, false, GetOwner()});
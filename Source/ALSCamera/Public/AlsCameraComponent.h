@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Components/SkeletalMeshComponent.h"
+#include "Containers/StaticArray.h"
+#include "Engine/OverlapResult.h"
 #include "Interfaces/MovementBaseInterface.h"
 #include "Utility/AlsMath.h"
 #include "AlsCameraComponent.generated.h"
@@ -8,6 +10,30 @@
 class UAlsCameraSettings;
 class ACharacter;
 
+/// Values of all camera animation curves, read once per camera tick.
+struct ALSCAMERA_API FAlsCameraCurves
+{
+	/// Number of camera curves, one per float value of this struct.
+	static constexpr auto CurvesCount{13};
+
+	FVector3f PivotOffset{ForceInit};
+
+	FVector3f CameraOffset{ForceInit};
+
+	FVector3f LocationLag{ForceInit};
+
+	float RotationLag{0.0f};
+
+	float FovOffset{0.0f};
+
+	float FirstPersonOverride{0.0f};
+
+	float TraceOverride{0.0f};
+};
+
+static_assert(sizeof(FAlsCameraCurves) == FAlsCameraCurves::CurvesCount * sizeof(float),
+              "FAlsCameraCurves::CurvesCount must match the number of values in the struct.");
+
 UCLASS(ClassGroup = "ALS", Meta = (BlueprintSpawnableComponent),
 	HideCategories = ("ComponentTick", "Clothing", "Physics", "MasterPoseComponent", "Collision", "AnimationRig",
 		"Lighting", "Deformer", "Rendering", "PathTracing", "HLOD", "Navigation", "VirtualTexture", "SkeletalMesh",
@@ -75,6 +101,12 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	uint8 bRightShoulder : 1 {true};
 
+	// Element ids of the camera curves in the animation curves map, in the order in which they are read in ReadCurves().
+	TStaticArray<FSetElementId, FAlsCameraCurves::CurvesCount> CurveElementIds;
+
+	// Overlap results of TryAdjustLocationBlockedByGeometry(), kept per camera to reuse the array allocation between ticks.
+	mutable TArray<FOverlapResult> Overlaps;
+
 public:
 	UAlsCameraComponent();
 
@@ -134,19 +166,24 @@ public:
 private:
 	void TickCamera(float DeltaTime, bool bAllowLag = true);
 
-	FRotator CalculateCameraRotation(const FRotator& CameraTargetRotation, float DeltaTime, bool bAllowLag) const;
+	FAlsCameraCurves ReadCurves();
 
-	FVector CalculatePivotLagLocation(const FQuat& CameraYawRotation, float DeltaTime, bool bAllowLag) const;
+	FRotator CalculateCameraRotation(const FAlsCameraCurves& Curves, const FRotator& CameraTargetRotation,
+	                                 float DeltaTime, bool bAllowLag) const;
 
-	FVector CalculatePivotOffset() const;
+	FVector CalculatePivotLagLocation(const FAlsCameraCurves& Curves, const FQuat& CameraYawRotation,
+	                                  float DeltaTime, bool bAllowLag) const;
 
-	FVector CalculateCameraOffset() const;
+	FVector CalculatePivotOffset(const FAlsCameraCurves& Curves) const;
 
-	float CalculateFovOffset() const;
+	FVector CalculateCameraOffset(const FAlsCameraCurves& Curves) const;
 
-	FVector CalculateCameraTrace(const FVector& CameraTargetLocation, const FVector& PivotOffset,
+	FVector CalculateCameraTrace(const FAlsCameraCurves& Curves, const FVector& CameraTargetLocation, const FVector& PivotOffset,
 	                             float DeltaTime, bool bAllowLag, float& NewTraceDistanceRatio) const;
 
+public:
+	// Only reads the scene and uses the camera's own overlap results array, so collision resolution of
+	// different cameras can run in parallel on worker threads, as long as bDisplayDebugCameraTraces is false.
 	bool TryAdjustLocationBlockedByGeometry(FVector& Location, bool bDisplayDebugCameraTraces) const;
 
 	// Debug